@@ -3,12 +3,16 @@
 
 #include <rpp/rpp.hpp>
 
+#include <cstring>
+#include <filesystem>
 #include <fstream>
 #include <functional>
 #include <iostream>
+#include <list>
 #include <map>
 #include <span>
 #include <string_view>
+#include <thread>
 #include <tuple>
 #ifdef RPP_BUILD_RXCPP
     #include <rxcpp/rx.hpp>
@@ -65,6 +69,25 @@ namespace rpp
     }
 } // namespace rpp
 
+namespace
+{
+    struct int_serializer
+    {
+        void serialize(int v, std::vector<std::byte>& out) const
+        {
+            const auto bytes = std::as_bytes(std::span{&v, 1});
+            out.insert(out.end(), bytes.begin(), bytes.end());
+        }
+
+        int deserialize(std::span<const std::byte> bytes) const
+        {
+            int v{};
+            std::memcpy(&v, bytes.data(), sizeof(v));
+            return v;
+        }
+    };
+} // namespace
+
 #ifdef RPP_BUILD_RXCPP
 namespace rxcpp
 {
@@ -174,6 +197,42 @@ int main(int argc, char* argv[]) // NOLINT(bugprone-exception-escape)
             });
         }
 
+        SECTION("from list of 10000 - create + as_blocking + subscribe + new_thread")
+        {
+            std::list<int> vals(10000);
+            TEST_RPP([&]() {
+                (rpp::source::from_iterable(vals, rpp::schedulers::new_thread{}) | rpp::ops::as_blocking()).subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+            });
+
+            TEST_RXCPP([&]() {
+                (rxcpp::observable<>::iterate(vals, rxcpp::observe_on_new_thread()) | rxcpp::operators::as_blocking()).subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+            });
+        }
+
+        SECTION("from list of 10000 with batch 100 - create + as_blocking + subscribe + new_thread")
+        {
+            std::list<int> vals(10000);
+            TEST_RPP([&]() {
+                (rpp::source::from_iterable(vals, rpp::schedulers::new_thread{}, 100) | rpp::ops::as_blocking()).subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+            });
+        }
+
+        SECTION("from vector of 1000 - create with use_shared + subscribe + immediate")
+        {
+            std::vector<int> vals(1000);
+            TEST_RPP([&]() {
+                rpp::source::from_iterable<rpp::memory_model::use_shared>(vals, rpp::schedulers::immediate{}).subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+            });
+        }
+
+        SECTION("from vector of 1000 - create via from_span + subscribe + immediate")
+        {
+            std::vector<int> vals(1000);
+            TEST_RPP([&]() {
+                rpp::source::from_span(vals, rpp::schedulers::immediate{}).subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+            });
+        }
+
         SECTION("concat_as_source of just(1 immediate) create + subscribe")
         {
             TEST_RPP([&]() {
@@ -336,6 +395,28 @@ int main(int argc, char* argv[]) // NOLINT(bugprone-exception-escape)
             });
         }
 
+        SECTION("4 threads x 1000 on_next to subjects + merge_with + subscribe")
+        {
+            TEST_RPP([&]() {
+                std::vector<rpp::subjects::publish_subject<int>> subjects(4);
+
+                subjects[0].get_observable()
+                    | rpp::operators::merge_with(subjects[1].get_observable(), subjects[2].get_observable(), subjects[3].get_observable())
+                    | rpp::operators::subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+
+                std::vector<std::thread> threads{};
+                for (const auto& subj : subjects)
+                {
+                    threads.emplace_back([obs = subj.get_observer()] {
+                        for (int v = 0; v < 1000; ++v)
+                            obs.on_next(v);
+                    });
+                }
+                for (auto& t : threads)
+                    t.join();
+            });
+        }
+
         SECTION("immediate_just(1) + with_latest_from(immediate_just(2)) + subscribe")
         {
             TEST_RPP([&]() {
@@ -353,6 +434,26 @@ int main(int argc, char* argv[]) // NOLINT(bugprone-exception-escape)
             // });
         }
 
+        SECTION("subject + with_latest_from(2 subjects) + 1000 on_next to source")
+        {
+            TEST_RPP([&]() {
+                rpp::subjects::publish_subject<int>         source{};
+                rpp::subjects::publish_subject<int>         number{};
+                rpp::subjects::publish_subject<std::string> text{};
+
+                source.get_observable()
+                    | rpp::operators::with_latest_from(number.get_observable(), text.get_observable())
+                    | rpp::operators::subscribe([](const std::tuple<int, int, std::string>& v) { ankerl::nanobench::doNotOptimizeAway(v); });
+
+                number.get_observer().on_next(1);
+                text.get_observer().on_next("config");
+
+                const auto observer = source.get_observer();
+                for (int i = 0; i < 1000; ++i)
+                    observer.on_next(i);
+            });
+        }
+
         SECTION("immediate_just(immediate_just(1),immediate_just(1)) + switch_on_next() + subscribe")
         {
             TEST_RPP([&]() {
@@ -492,6 +593,42 @@ int main(int argc, char* argv[]) // NOLINT(bugprone-exception-escape)
                     | rxcpp::operators::subscribe<rxcpp::observable<int>>([](const rxcpp::observable<int>& v) { v.subscribe([](int vv) { ankerl::nanobench::doNotOptimizeAway(vv); }); });
             });
         }
+
+        {
+            const auto cpu_bound = [](int v) {
+                auto x = static_cast<uint64_t>(v);
+                for (int i = 0; i < 10000; ++i)
+                    x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+                return x;
+            };
+            const std::vector<int>             vals(1000);
+            const rpp::schedulers::thread_pool pool{4};
+
+            SECTION("from array of 1000 + map(cpu-bound) + subscribe")
+            {
+                TEST_RPP([&]() {
+                    rpp::source::from_iterable(vals)
+                        | rpp::operators::map(cpu_bound)
+                        | rpp::operators::subscribe([](uint64_t v) { ankerl::nanobench::doNotOptimizeAway(v); });
+                });
+            }
+
+            SECTION("from array of 1000 + parallel_map(cpu-bound, thread_pool{4}, 64) + as_blocking + subscribe")
+            {
+                TEST_RPP([&]() {
+                    (rpp::source::from_iterable(vals) | rpp::operators::parallel_map(cpu_bound, pool, 64) | rpp::operators::as_blocking())
+                        .subscribe([](uint64_t v) { ankerl::nanobench::doNotOptimizeAway(v); });
+                });
+            }
+
+            SECTION("from array of 1000 + parallel_map_unordered(cpu-bound, thread_pool{4}, 64) + as_blocking + subscribe")
+            {
+                TEST_RPP([&]() {
+                    (rpp::source::from_iterable(vals) | rpp::operators::parallel_map_unordered(cpu_bound, pool, 64) | rpp::operators::as_blocking())
+                        .subscribe([](uint64_t v) { ankerl::nanobench::doNotOptimizeAway(v); });
+                });
+            }
+        }
     }; // BENCHMARK("Transforming Operators")
 
     BENCHMARK("Filtering Operators")
@@ -633,6 +770,18 @@ int main(int argc, char* argv[]) // NOLINT(bugprone-exception-escape)
                     | rxcpp::operators::subscribe<int>([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
             });
         }
+
+        SECTION("from array of 10000 + observe_on(new_thread) + as_blocking + subscribe")
+        {
+            std::vector<int> vals(10000);
+            TEST_RPP([&]() {
+                (rpp::source::from_iterable(vals) | rpp::ops::observe_on(rpp::schedulers::new_thread{}) | rpp::ops::as_blocking()).subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+            });
+
+            TEST_RXCPP([&]() {
+                (rxcpp::observable<>::iterate(vals) | rxcpp::operators::observe_on(rxcpp::observe_on_new_thread()) | rxcpp::operators::as_blocking()).subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+            });
+        }
     } // BENCHMARK("Utility Operators")
 
     BENCHMARK("Aggregating Operators")
@@ -651,6 +800,34 @@ int main(int argc, char* argv[]) // NOLINT(bugprone-exception-escape)
                     | rxcpp::operators::subscribe<int>([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
             });
         }
+
+        {
+            const auto cpu_bound = [](uint64_t s, int v) {
+                auto x = static_cast<uint64_t>(v);
+                for (int i = 0; i < 1000; ++i)
+                    x = x * 6364136223846793005ULL + 1442695040888963407ULL;
+                return s ^ x;
+            };
+            const std::vector<int>             vals(10000);
+            const rpp::schedulers::thread_pool pool{4};
+
+            SECTION("from array of 10000 + reduce(cpu-bound) + subscribe")
+            {
+                TEST_RPP([&]() {
+                    rpp::source::from_iterable(vals)
+                        | rpp::operators::reduce(uint64_t{}, cpu_bound)
+                        | rpp::operators::subscribe([](uint64_t v) { ankerl::nanobench::doNotOptimizeAway(v); });
+                });
+            }
+
+            SECTION("from array of 10000 + parallel_reduce(cpu-bound, thread_pool{4}, 256) + as_blocking + subscribe")
+            {
+                TEST_RPP([&]() {
+                    (rpp::source::from_iterable(vals) | rpp::operators::parallel_reduce(uint64_t{}, cpu_bound, std::bit_xor<uint64_t>{}, pool, 256) | rpp::operators::as_blocking())
+                        .subscribe([](uint64_t v) { ankerl::nanobench::doNotOptimizeAway(v); });
+                });
+            }
+        }
     } // BENCHMARK("Aggregating Operators")
 
     BENCHMARK("Error Handling Operators")
@@ -763,6 +940,184 @@ int main(int argc, char* argv[]) // NOLINT(bugprone-exception-escape)
                 });
             }
         }
+        for (const size_t observers_count : {size_t{1}, size_t{100}, size_t{10000}})
+        {
+            const auto name = "on_next to " + std::to_string(observers_count) + " observers of publish_subject";
+            SECTION(name.c_str())
+            {
+                {
+                    rpp::subjects::publish_subject<int> rpp_subj{};
+                    for (size_t i = 0; i < observers_count; ++i)
+                    {
+                        rpp_subj.get_observable().subscribe(rpp::make_lambda_observer([](int v) { ankerl::nanobench::doNotOptimizeAway(v); }));
+                    }
+                    TEST_RPP([&] {
+                        rpp_subj.get_observer().on_next(1);
+                    });
+                }
+
+                {
+#ifdef RPP_BUILD_RXCPP
+                    rxcpp::subjects::subject<int> rxcpp_subj{};
+                    for (size_t i = 0; i < observers_count; ++i)
+                    {
+                        rxcpp_subj.get_observable().subscribe(rxcpp::make_subscriber<int>([](int v) { ankerl::nanobench::doNotOptimizeAway(v); }));
+                    }
+#endif
+                    TEST_RXCPP([&] {
+                        rxcpp_subj.get_subscriber().on_next(1);
+                    });
+                }
+            }
+        }
+        SECTION("subscribe and unsubscribe 100 observers of publish_subject")
+        {
+            TEST_RPP([&] {
+                rpp::subjects::publish_subject<int>            s{};
+                std::vector<rpp::composite_disposable_wrapper> disposables{};
+                disposables.reserve(100);
+                for (size_t i = 0; i < 100; ++i)
+                {
+                    disposables.push_back(s.get_observable().subscribe_with_disposable([](int v) { ankerl::nanobench::doNotOptimizeAway(v); }));
+                }
+                s.get_observer().on_next(1);
+                for (const auto& d : disposables)
+                    d.dispose();
+            });
+            TEST_RXCPP([&] {
+                rxcpp::subjects::subject<int>     s{};
+                std::vector<rxcpp::subscription> subscriptions{};
+                subscriptions.reserve(100);
+                for (size_t i = 0; i < 100; ++i)
+                {
+                    subscriptions.push_back(s.get_observable().subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); }));
+                }
+                s.get_subscriber().on_next(1);
+                for (auto& d : subscriptions)
+                    d.unsubscribe();
+            });
+        }
+        SECTION("serialized_publish_subject: 4 threads x 1000 on_next to 1 observer")
+        {
+            TEST_RPP([&] {
+                rpp::subjects::serialized_publish_subject<int> s{};
+                s.get_observable().subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+
+                std::vector<std::thread> threads{};
+                for (size_t i = 0; i < 4; ++i)
+                {
+                    threads.emplace_back([&s] {
+                        const auto obs = s.get_observer();
+                        for (int v = 0; v < 1000; ++v)
+                            obs.on_next(v);
+                    });
+                }
+                for (auto& t : threads)
+                    t.join();
+            });
+        }
+        SECTION("behavior_subject: 4 threads x 10000 get_value with concurrent 10000 on_next")
+        {
+            TEST_RPP([&] {
+                rpp::subjects::behavior_subject<int> s{0};
+
+                std::vector<std::thread> threads{};
+                for (size_t i = 0; i < 4; ++i)
+                {
+                    threads.emplace_back([&s] {
+                        for (int v = 0; v < 10000; ++v)
+                            ankerl::nanobench::doNotOptimizeAway(s.get_value());
+                    });
+                }
+                threads.emplace_back([&s] {
+                    const auto obs = s.get_observer();
+                    for (int v = 0; v < 10000; ++v)
+                        obs.on_next(v);
+                });
+                for (auto& t : threads)
+                    t.join();
+            });
+        }
+        SECTION("publish_subject: on_next of 64KB vector by rvalue to 1 observer taking ownership")
+        {
+            rpp::subjects::publish_subject<std::vector<uint8_t>> s{};
+            s.get_observable().subscribe([](std::vector<uint8_t> v) { ankerl::nanobench::doNotOptimizeAway(v); });
+            const auto obs = s.get_observer();
+
+            TEST_RPP([&] {
+                obs.on_next(std::vector<uint8_t>(64 * 1024, 1));
+            });
+        }
+        // each observer imitates some work per value, e.g. serialization for its client
+        const auto observer_work = [](int v) {
+            size_t res = static_cast<size_t>(v);
+            for (size_t i = 0; i < 100; ++i)
+                res = res * 31 + i;
+            ankerl::nanobench::doNotOptimizeAway(res);
+        };
+        SECTION("publish_subject: 100 on_next to 1000 observers with some work")
+        {
+            TEST_RPP([&] {
+                rpp::subjects::publish_subject<int> s{};
+                for (size_t i = 0; i < 1000; ++i)
+                    s.get_observable().subscribe(observer_work);
+
+                const auto obs = s.get_observer();
+                for (int v = 0; v < 100; ++v)
+                    obs.on_next(v);
+                obs.on_completed();
+            });
+        }
+        SECTION("fanout_subject with thread_pool{4} and 4 shards: 100 on_next to 1000 observers with some work")
+        {
+            const rpp::schedulers::thread_pool pool{4};
+            TEST_RPP([&] {
+                rpp::subjects::fanout_subject<int, rpp::schedulers::thread_pool> s{pool, 4};
+
+                std::atomic<size_t> completed{};
+                for (size_t i = 0; i < 1000; ++i)
+                    s.get_observable().subscribe(observer_work, [&completed] { completed.fetch_add(1, std::memory_order::relaxed); });
+
+                const auto obs = s.get_observer();
+                for (int v = 0; v < 100; ++v)
+                    obs.on_next(v);
+                obs.on_completed();
+
+                while (completed.load(std::memory_order::relaxed) != 1000)
+                    std::this_thread::yield();
+            });
+        }
+        SECTION("subscribe to replay_subject with 100000 values")
+        {
+            rpp::subjects::replay_subject<int> s{100000};
+            for (int v = 0; v < 200000; ++v)
+                s.get_observer().on_next(v);
+
+            TEST_RPP([&] {
+                s.get_observable().subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+            });
+        }
+        SECTION("on_next to replay_subject with 100000 values")
+        {
+            rpp::subjects::replay_subject<int> s{100000};
+            s.get_observable().subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+            for (int v = 0; v < 100000; ++v)
+                s.get_observer().on_next(v);
+
+            TEST_RPP([&] {
+                s.get_observer().on_next(1);
+            });
+        }
+        SECTION("subscribe to spilling_replay_subject with 100000 values")
+        {
+            rpp::subjects::spilling_replay_subject<int, int_serializer> s{std::filesystem::temp_directory_path() / "rpp_benchmark_spill.bin", 1000};
+            for (int v = 0; v < 100000; ++v)
+                s.get_observer().on_next(v);
+
+            TEST_RPP([&] {
+                s.get_observable().subscribe([](int v) { ankerl::nanobench::doNotOptimizeAway(v); });
+            });
+        }
     } // BENCHMARK("Subjects")
 
     BENCHMARK("Scenarios")
@@ -109,9 +109,12 @@
  */
 
 #include <rpp/operators/buffer.hpp>
+#include <rpp/operators/concat_map.hpp>
 #include <rpp/operators/flat_map.hpp>
 #include <rpp/operators/group_by.hpp>
 #include <rpp/operators/map.hpp>
+#include <rpp/operators/parallel_map.hpp>
+#include <rpp/operators/partition_by.hpp>
 #include <rpp/operators/scan.hpp>
 #include <rpp/operators/subscribe.hpp>
 #include <rpp/operators/window.hpp>
@@ -173,6 +176,7 @@
 #include <rpp/operators/delay.hpp>
 #include <rpp/operators/finally.hpp>
 #include <rpp/operators/observe_on.hpp>
+#include <rpp/operators/on_backpressure_buffer.hpp>
 #include <rpp/operators/repeat.hpp>
 #include <rpp/operators/subscribe_on.hpp>
 #include <rpp/operators/tap.hpp>
@@ -197,7 +201,9 @@
  */
 
 #include <rpp/operators/concat.hpp>
+#include <rpp/operators/parallel_reduce.hpp>
 #include <rpp/operators/reduce.hpp>
+#include <rpp/operators/sliding_aggregate.hpp>
 
 /**
  * @defgroup error_handling_operators Error Handling Operators
@@ -13,9 +13,12 @@
 #include <rpp/operators/fwd.hpp>
 
 #include <rpp/defs.hpp>
+#include <rpp/disposables/composite_disposable.hpp>
 #include <rpp/operators/details/strategy.hpp>
 
 #include <cstddef>
+#include <mutex>
+#include <vector>
 
 namespace rpp::operators::details
 {
@@ -83,6 +86,155 @@ namespace rpp::operators::details
         template<rpp::details::observables::constraint::disposables_strategy Prev>
         using updated_optimal_disposables_strategy = Prev;
     };
+
+    template<rpp::constraint::observer Observer, typename Worker, rpp::details::disposables::constraint::disposables_container Container>
+    class buffer_with_time_disposable;
+
+    template<rpp::constraint::observer Observer, typename Worker, rpp::details::disposables::constraint::disposables_container Container>
+    struct buffer_with_time_disposable_wrapper
+    {
+        std::shared_ptr<buffer_with_time_disposable<Observer, Worker, Container>> disposable{};
+
+        bool is_disposed() const { return disposable->is_disposed(); }
+
+        void on_error(const std::exception_ptr& err) const { disposable->on_error(err); }
+    };
+
+    template<rpp::constraint::observer Observer, typename Worker, rpp::details::disposables::constraint::disposables_container Container>
+    class buffer_with_time_disposable final : public rpp::composite_disposable_impl<Container>
+        , public rpp::details::enable_wrapper_from_this<buffer_with_time_disposable<Observer, Worker, Container>>
+    {
+        using container  = rpp::utils::extract_observer_type_t<Observer>;
+        using value_type = typename container::value_type;
+        static_assert(std::same_as<container, std::vector<value_type>>);
+
+    public:
+        buffer_with_time_disposable(Observer&& observer, Worker&& worker, rpp::schedulers::duration period, size_t count)
+            : m_observer{std::move(observer)}
+            , m_worker{std::move(worker)}
+            , m_period{period}
+            , m_count{count}
+        {
+            m_bucket.reserve(m_count);
+        }
+
+        // called only once during creation of state before any emission
+        void set_upstream(const disposable_wrapper& d) { m_observer.set_upstream(d); }
+
+        void start_timer()
+        {
+            m_worker.schedule(
+                m_period,
+                [](const buffer_with_time_disposable_wrapper<Observer, Worker, Container>& handler) -> schedulers::optional_delay_from_this_timepoint {
+                    handler.disposable->flush();
+                    return schedulers::optional_delay_from_this_timepoint{handler.disposable->m_period};
+                },
+                buffer_with_time_disposable_wrapper<Observer, Worker, Container>{this->wrapper_from_this().lock()});
+        }
+
+        template<typename T>
+        void on_next(T&& v)
+        {
+            std::lock_guard lock{m_mutex};
+            m_bucket.push_back(std::forward<T>(v));
+            if (m_bucket.size() == m_count)
+                flush_unsafe();
+        }
+
+        void on_error(const std::exception_ptr& err)
+        {
+            std::lock_guard lock{m_mutex};
+            m_observer.on_error(err);
+        }
+
+        void on_completed()
+        {
+            std::lock_guard lock{m_mutex};
+            flush_unsafe();
+            m_observer.on_completed();
+        }
+
+    private:
+        void flush()
+        {
+            std::lock_guard lock{m_mutex};
+            flush_unsafe();
+        }
+
+        void flush_unsafe()
+        {
+            if (m_bucket.empty() || m_observer.is_disposed())
+                return;
+
+            // next bucket is expected to be of the same size, so reserve it at once instead of growing
+            const auto size = m_bucket.size();
+            m_observer.on_next(std::move(m_bucket));
+
+            m_bucket.clear();
+            m_bucket.reserve(m_count != 0 ? m_count : size);
+        }
+
+    private:
+        RPP_NO_UNIQUE_ADDRESS Observer  m_observer;
+        RPP_NO_UNIQUE_ADDRESS Worker    m_worker;
+        const rpp::schedulers::duration m_period;
+        const size_t                    m_count;
+
+        std::mutex              m_mutex{};
+        std::vector<value_type> m_bucket{};
+    };
+
+    template<rpp::constraint::observer Observer, typename Worker, rpp::details::disposables::constraint::disposables_container Container>
+    struct buffer_with_time_observer_strategy
+    {
+        static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::None;
+
+        std::shared_ptr<buffer_with_time_disposable<Observer, Worker, Container>> disposable{};
+
+        void set_upstream(const rpp::disposable_wrapper& d) const { disposable->add(d); }
+
+        bool is_disposed() const { return disposable->is_disposed(); }
+
+        template<typename T>
+        void on_next(T&& v) const
+        {
+            disposable->on_next(std::forward<T>(v));
+        }
+
+        void on_error(const std::exception_ptr& err) const { disposable->on_error(err); }
+
+        void on_completed() const { disposable->on_completed(); }
+    };
+
+    template<rpp::schedulers::constraint::scheduler Scheduler>
+    struct buffer_with_time_t
+    {
+        template<rpp::constraint::decayed_type T>
+        struct operator_traits
+        {
+            using result_type = std::vector<T>;
+        };
+
+        template<rpp::details::observables::constraint::disposables_strategy Prev>
+        using updated_optimal_disposables_strategy = rpp::details::observables::fixed_disposables_strategy<1>;
+
+        rpp::schedulers::duration       period;
+        size_t                          count;
+        RPP_NO_UNIQUE_ADDRESS Scheduler scheduler;
+
+        template<rpp::constraint::decayed_type Type, rpp::details::observables::constraint::disposables_strategy DisposableStrategy, rpp::constraint::observer Observer>
+        auto lift_with_disposables_strategy(Observer&& observer) const
+        {
+            using worker_t  = rpp::schedulers::utils::get_worker_t<Scheduler>;
+            using container = typename DisposableStrategy::disposables_container;
+
+            const auto disposable = disposable_wrapper_impl<buffer_with_time_disposable<std::decay_t<Observer>, worker_t, container>>::make(std::forward<Observer>(observer), scheduler.create_worker(), period, count);
+            auto       ptr        = disposable.lock();
+            ptr->set_upstream(disposable.as_weak());
+            ptr->start_timer();
+            return rpp::observer<Type, buffer_with_time_observer_strategy<std::decay_t<Observer>, worker_t, container>>{std::move(ptr)};
+        }
+    };
 } // namespace rpp::operators::details
 
 namespace rpp::operators
@@ -112,4 +264,63 @@ namespace rpp::operators
     {
         return details::buffer_t{count};
     }
+
+    /**
+     * @brief Periodically gather emissions emitted by an original Observable into bundles and emit these bundles every `period` of time
+     *
+     * @marble buffer_with_time
+         {
+             source observable                 : +-1-2-3---4-|
+             operator "buffer_with_time(4)"    : +---{1,2}-{3}-{4}|
+         }
+     *
+     * @details Timer is started on subscription and ticks every `period` independently of emissions. Empty bundles are not emitted. Remaining items are emitted on completion.
+     *
+     * @par Performance notes:
+     * - 1 heap allocation for disposable
+     * - mutex acquired for each emission and for each timer tick
+     * - new bundle reserves size of the previous one, so bundle is not reallocated while growing under steady rate
+     *
+     * @param period period of time to gather emissions
+     * @param scheduler is scheduler used to run timer
+     * @note `#include <rpp/operators/buffer.hpp>`
+     *
+     * @ingroup transforming_operators
+     * @see https://reactivex.io/documentation/operators/buffer.html
+     */
+    template<rpp::schedulers::constraint::scheduler Scheduler>
+    auto buffer_with_time(rpp::schedulers::duration period, Scheduler&& scheduler)
+    {
+        return details::buffer_with_time_t<std::decay_t<Scheduler>>{period, 0, std::forward<Scheduler>(scheduler)};
+    }
+
+    /**
+     * @brief Gather emissions emitted by an original Observable into bundles and emit bundle when either `count` items gathered or `period` of time passed, whichever comes first.
+     *
+     * @marble buffer_with_time_or_count
+         {
+             source observable                          : +-1-2-3-4---5-|
+             operator "buffer_with_time_or_count(6,2)"  : +---{1,2}-{3,4}-{5}|
+         }
+     *
+     * @details Useful to batch items (for example, database writes) with upper bound of latency. Timer ticks every `period` independently of bundles emitted due to `count`. Empty bundles are not emitted. Remaining items are emitted on completion.
+     *
+     * @par Performance notes:
+     * - 1 heap allocation for disposable
+     * - mutex acquired for each emission and for each timer tick
+     * - each bundle reserves `count` items at once, so bundle is never reallocated while growing
+     *
+     * @param period maximum period of time to gather emissions
+     * @param count maximum amount of items in bundle. 0 means unlimited
+     * @param scheduler is scheduler used to run timer
+     * @note `#include <rpp/operators/buffer.hpp>`
+     *
+     * @ingroup transforming_operators
+     * @see https://reactivex.io/documentation/operators/buffer.html
+     */
+    template<rpp::schedulers::constraint::scheduler Scheduler>
+    auto buffer_with_time_or_count(rpp::schedulers::duration period, size_t count, Scheduler&& scheduler)
+    {
+        return details::buffer_with_time_t<std::decay_t<Scheduler>>{period, count, std::forward<Scheduler>(scheduler)};
+    }
 } // namespace rpp::operators
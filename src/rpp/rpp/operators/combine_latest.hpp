@@ -19,18 +19,31 @@
 namespace rpp::operators::details
 {
     template<rpp::constraint::observer Observer, typename TSelector, rpp::constraint::decayed_type... Args>
-    class combine_latest_disposable final : public combining_disposable<Observer>
+    class combine_latest_disposable final : public combining_disposable<combine_latest_disposable<Observer, TSelector, Args...>, Observer, Args...>
     {
+        using base = combining_disposable<combine_latest_disposable<Observer, TSelector, Args...>, Observer, Args...>;
+
     public:
-        explicit combine_latest_disposable(Observer&& observer, const TSelector& selector)
-            : combining_disposable<Observer>(std::move(observer), sizeof...(Args))
+        explicit combine_latest_disposable(Observer&& observer, const TSelector& selector, rpp::utils::none)
+            : base(std::move(observer))
             , m_selector(selector)
         {
         }
 
-        const auto& get_selector() const { return m_selector; }
+        // values are updated and combined serially, so new value can't be updated while old one is being sent
+        template<size_t I, typename T>
+        void emit_next(T&& v)
+        {
+            m_values.template get<I>().emplace(std::forward<T>(v));
+            m_values.apply(&apply_impl, this);
+        }
 
-        auto& get_values() { return m_values; }
+    private:
+        static void apply_impl(const combine_latest_disposable* disposable, const std::optional<Args>&... vals)
+        {
+            if ((vals.has_value() && ...))
+                disposable->get_observer().on_next(disposable->m_selector(vals.value()...));
+        }
 
     private:
         rpp::utils::tuple<std::optional<Args>...> m_values{};
@@ -47,24 +60,12 @@ namespace rpp::operators::details
         template<typename T>
         void on_next(T&& v) const
         {
-            // mutex need to be locked during changing of values, generating new values and sending of new values due to we can't update value while we are sending old one
-            const auto observer = disposable->get_observer_under_lock();
-            disposable->get_values().template get<I>().emplace(std::forward<T>(v));
-
-            disposable->get_values().apply(&apply_impl<decltype(disposable)>, disposable, observer);
-        }
-
-    private:
-        template<typename TDisposable>
-        static void apply_impl(const TDisposable& disposable, const rpp::utils::pointer_under_lock<Observer>& observer, const std::optional<Args>&... vals)
-        {
-            if ((vals.has_value() && ...))
-                observer->on_next(disposable->get_selector()(vals.value()...));
+            disposable->template on_next<I>(std::forward<T>(v));
         }
     };
 
     template<typename TSelector, rpp::constraint::observable... TObservables>
-    struct combine_latest_t : public combining_operator_t<combine_latest_disposable, combine_latest_observer_strategy, TSelector, TObservables...>
+    struct combine_latest_t : public combining_operator_t<combine_latest_disposable, combine_latest_observer_strategy, TSelector, rpp::utils::none, TObservables...>
     {
     };
 } // namespace rpp::operators::details
@@ -86,7 +87,7 @@ namespace rpp::operators
      * @par Performance notes:
      * - 1 heap allocation for disposable
      * - each value from any observable copied/moved to internal storage
-     * - mutex acquired every time value obtained
+     * - emissions are serialized via lock-free queue: value obtained while another observable is emitting is queued and combined by emitting thread
      *
      * @param selector is applied to current emission of current observable and latests emissions from observables
      * @param observables are observables whose emissions would be combined with current observable
@@ -104,7 +105,8 @@ namespace rpp::operators
     {
         return details::combine_latest_t<std::decay_t<TSelector>, std::decay_t<TObservable>, std::decay_t<TObservables>...>{
             rpp::utils::tuple{std::forward<TObservable>(observable), std::forward<TObservables>(observables)...},
-            std::forward<TSelector>(selector)};
+            std::forward<TSelector>(selector),
+            rpp::utils::none{}};
     }
 
     /**
@@ -124,7 +126,7 @@ namespace rpp::operators
      * @par Performance notes:
      * - 1 heap allocation for disposable
      * - each value from any observable copied/moved to internal storage
-     * - mutex acquired every time value obtained
+     * - emissions are serialized via lock-free queue: value obtained while another observable is emitting is queued and combined by emitting thread
      *
      * @param observables are observables whose emissions would be combined when any observable sends new value
      * @note `#include <rpp/operators/combine_latest.hpp>`
@@ -81,8 +81,12 @@ namespace rpp::operators::details
     private:
         bool handle_observable_impl(const rpp::constraint::decayed_same_as<TObservable> auto& observable)
         {
+            auto self = disposable_wrapper_impl<concat_disposable>{this->wrapper_from_this()}.lock();
+            if (!self) // state is being destroyed
+                return true;
+
             stage().store(ConcatStage::Draining, std::memory_order::relaxed);
-            observable.subscribe(concat_inner_observer_strategy<TObservable, TObserver>{disposable_wrapper_impl<concat_disposable>{this->wrapper_from_this()}.lock()});
+            observable.subscribe(concat_inner_observer_strategy<TObservable, TObserver>{std::move(self)});
 
             ConcatStage current = ConcatStage::Draining;
             return stage().compare_exchange_strong(current, ConcatStage::Processing, std::memory_order::seq_cst);
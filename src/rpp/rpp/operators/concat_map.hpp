@@ -0,0 +1,406 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/operators/fwd.hpp>
+
+#include <rpp/defs.hpp>
+#include <rpp/disposables/composite_disposable.hpp>
+#include <rpp/operators/concat.hpp>
+#include <rpp/operators/details/strategy.hpp>
+#include <rpp/operators/map.hpp>
+#include <rpp/utils/utils.hpp>
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <optional>
+#include <queue>
+#include <variant>
+#include <vector>
+
+namespace rpp::operators::details
+{
+    template<rpp::constraint::observable TObservable, rpp::constraint::observer TObserver>
+    struct concat_prefetch_inner_observer_strategy;
+
+    /**
+     * @brief Values of inner observable obtained before it becomes the current one.
+     */
+    template<rpp::constraint::decayed_type Type>
+    struct concat_prefetch_buffer
+    {
+        std::deque<Type> values{};
+        bool             completed{};
+    };
+
+    /**
+     * @brief State of concat with prefetch: current inner observable and up to `prefetch` upcoming ones are subscribed at the same time. Values of upcoming ones are buffered till they become current.
+     *
+     * @details Subscriptions and all emissions to observer are done by drain loop: only one thread drains at a time, others just update state and notify it.
+     */
+    template<rpp::constraint::observable TObservable, rpp::constraint::observer TObserver>
+    class concat_prefetch_disposable final : public composite_disposable
+    {
+        using Type   = rpp::utils::extract_observable_type_t<TObservable>;
+        using buffer = concat_prefetch_buffer<Type>;
+
+        struct state_t
+        {
+            std::queue<TObservable>             pending{};
+            std::deque<std::shared_ptr<buffer>> active{};
+            std::optional<std::exception_ptr>   error{};
+            bool                                completed{};
+        };
+
+        struct idle
+        {
+        };
+
+        struct next_value
+        {
+            Type value;
+        };
+
+        struct subscribe_next
+        {
+            TObservable             observable;
+            std::shared_ptr<buffer> inner;
+        };
+
+        struct terminal_completed
+        {
+        };
+
+        using action = std::variant<idle, next_value, subscribe_next, std::exception_ptr, terminal_completed>;
+
+    public:
+        concat_prefetch_disposable(TObserver&& observer, size_t prefetch)
+            : m_observer{std::move(observer)}
+            , m_max_active{prefetch + 1}
+        {
+        }
+
+        // called only once during creation of state before any emission
+        void set_upstream(const disposable_wrapper& d) { m_observer.set_upstream(d); }
+
+        template<rpp::constraint::decayed_same_as<TObservable> T>
+        void push_observable(T&& observable)
+        {
+            m_state.lock()->pending.push(std::forward<T>(observable));
+        }
+
+        template<typename T>
+        void push_value(buffer& inner, T&& v)
+        {
+            const auto state = m_state.lock();
+            inner.values.push_back(std::forward<T>(v));
+        }
+
+        void complete_inner(buffer& inner)
+        {
+            const auto state = m_state.lock();
+            inner.completed  = true;
+        }
+
+        void complete() { m_state.lock()->completed = true; }
+
+        void error(const std::exception_ptr& err)
+        {
+            auto state = m_state.lock();
+            if (!state->error)
+                state->error = err;
+        }
+
+        static void drain(const std::shared_ptr<concat_prefetch_disposable>& self)
+        {
+            if (self->m_drain_wip.fetch_add(1, std::memory_order::acq_rel) != 0)
+                return;
+
+            size_t missed = 1;
+            while (missed != 0)
+            {
+                // `wip` is never released after terminal event, so nothing could be emitted after it
+                if (!drain_available(self))
+                    return;
+
+                missed = self->m_drain_wip.fetch_sub(missed, std::memory_order::acq_rel) - missed;
+            }
+        }
+
+    private:
+        static bool drain_available(const std::shared_ptr<concat_prefetch_disposable>& self)
+        {
+            while (!self->is_disposed())
+            {
+                auto next = self->next_action();
+                if (std::holds_alternative<idle>(next))
+                    return true;
+
+                if (auto* v = std::get_if<next_value>(&next))
+                {
+                    self->m_observer.on_next(std::move(v->value));
+                }
+                else if (auto* subscribe = std::get_if<subscribe_next>(&next))
+                {
+                    std::move(subscribe->observable).subscribe(rpp::observer<Type, concat_prefetch_inner_observer_strategy<TObservable, TObserver>>{self, std::move(subscribe->inner)});
+                }
+                else if (auto* err = std::get_if<std::exception_ptr>(&next))
+                {
+                    self->m_observer.on_error(*err);
+                    return false;
+                }
+                else
+                {
+                    self->m_observer.on_completed();
+                    return false;
+                }
+            }
+            return false;
+        }
+
+        action next_action()
+        {
+            auto state = m_state.lock();
+            if (state->error)
+                return state->error.value();
+
+            while (true)
+            {
+                // subscribe to upcoming observables before emitting values to start them as soon as possible
+                if (!state->pending.empty() && state->active.size() < m_max_active)
+                {
+                    auto inner = std::make_shared<buffer>();
+                    state->active.push_back(inner);
+                    subscribe_next result{std::move(state->pending.front()), std::move(inner)};
+                    state->pending.pop();
+                    return result;
+                }
+
+                if (state->active.empty())
+                    return state->completed ? action{terminal_completed{}} : action{idle{}};
+
+                auto& current = *state->active.front();
+                if (!current.values.empty())
+                {
+                    next_value result{std::move(current.values.front())};
+                    current.values.pop_front();
+                    return result;
+                }
+
+                if (!current.completed)
+                    return idle{};
+
+                state->active.pop_front();
+            }
+        }
+
+        void composite_dispose_impl(interface_disposable::Mode) noexcept override
+        {
+            auto state     = m_state.lock();
+            state->pending = {};
+            state->active.clear();
+        }
+
+    private:
+        TObserver                             m_observer;
+        rpp::utils::value_with_mutex<state_t> m_state{};
+        std::atomic_size_t                    m_drain_wip{};
+        const size_t                          m_max_active;
+    };
+
+    template<rpp::constraint::observable TObservable, rpp::constraint::observer TObserver>
+    struct concat_prefetch_inner_observer_strategy
+    {
+        static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::Boolean;
+
+        using disposable_t = concat_prefetch_disposable<TObservable, TObserver>;
+
+        std::shared_ptr<disposable_t>                                                                 disposable;
+        std::shared_ptr<concat_prefetch_buffer<rpp::utils::extract_observable_type_t<TObservable>>> inner;
+        mutable std::vector<rpp::disposable_wrapper>                                                  disposables{};
+
+        template<typename T>
+        void on_next(T&& v) const
+        {
+            disposable->push_value(*inner, std::forward<T>(v));
+            disposable_t::drain(disposable);
+        }
+
+        void on_error(const std::exception_ptr& err) const
+        {
+            disposable->error(err);
+            disposable_t::drain(disposable);
+        }
+
+        void on_completed() const
+        {
+            for (const auto& d : disposables)
+            {
+                disposable->remove(d);
+                d.dispose();
+            }
+            disposable->complete_inner(*inner);
+            disposable_t::drain(disposable);
+        }
+
+        void set_upstream(const disposable_wrapper& d) const
+        {
+            disposable->add(d);
+            disposables.push_back(d);
+        }
+
+        bool is_disposed() const { return disposable->is_disposed(); }
+    };
+
+    template<rpp::constraint::observable TObservable, rpp::constraint::observer TObserver>
+    struct concat_prefetch_observer_strategy
+    {
+        static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::None;
+
+        using disposable_t = concat_prefetch_disposable<TObservable, TObserver>;
+
+        std::shared_ptr<disposable_t> disposable;
+
+        concat_prefetch_observer_strategy(TObserver&& observer, size_t prefetch)
+            : disposable{init_state(std::move(observer), prefetch)}
+        {
+        }
+
+        template<typename T>
+        void on_next(T&& v) const
+        {
+            disposable->push_observable(std::forward<T>(v));
+            disposable_t::drain(disposable);
+        }
+
+        void on_error(const std::exception_ptr& err) const
+        {
+            disposable->error(err);
+            disposable_t::drain(disposable);
+        }
+
+        void on_completed() const
+        {
+            disposable->complete();
+            disposable_t::drain(disposable);
+        }
+
+        void set_upstream(const disposable_wrapper& d) const { disposable->add(d); }
+
+        bool is_disposed() const { return disposable->is_disposed(); }
+
+    private:
+        static std::shared_ptr<disposable_t> init_state(TObserver&& observer, size_t prefetch)
+        {
+            const auto d   = disposable_wrapper_impl<disposable_t>::make(std::move(observer), prefetch);
+            auto       ptr = d.lock();
+            ptr->set_upstream(d.as_weak());
+            return ptr;
+        }
+    };
+
+    struct concat_prefetch_t : lift_operator<concat_prefetch_t, size_t>
+    {
+        using lift_operator<concat_prefetch_t, size_t>::lift_operator;
+
+        template<rpp::constraint::decayed_type T>
+        struct operator_traits
+        {
+            static_assert(rpp::constraint::observable<T>, "T is not observable");
+
+            using result_type = rpp::utils::extract_observable_type_t<T>;
+
+            template<rpp::constraint::observer_of_type<result_type> TObserver>
+            using observer_strategy = concat_prefetch_observer_strategy<T, std::decay_t<TObserver>>;
+        };
+
+        template<rpp::details::observables::constraint::disposables_strategy Prev>
+        using updated_optimal_disposables_strategy = rpp::details::observables::fixed_disposables_strategy<1>;
+    };
+
+    template<rpp::constraint::decayed_type Fn, rpp::constraint::decayed_type Concat = concat_t>
+    struct concat_map_t
+    {
+        RPP_NO_UNIQUE_ADDRESS Fn     m_fn;
+        RPP_NO_UNIQUE_ADDRESS Concat m_concat{};
+
+        template<rpp::constraint::observable TObservable>
+        auto operator()(TObservable&& observable) const &
+        {
+            static_assert(std::invocable<Fn, rpp::utils::extract_observable_type_t<TObservable>> && rpp::constraint::observable<std::invoke_result_t<Fn, rpp::utils::extract_observable_type_t<TObservable>>>, "fn should return observable");
+            return std::forward<TObservable>(observable)
+                 | rpp::ops::map(m_fn)
+                 | m_concat;
+        }
+
+        template<rpp::constraint::observable TObservable>
+        auto operator()(TObservable&& observable) &&
+        {
+            static_assert(std::invocable<Fn, rpp::utils::extract_observable_type_t<TObservable>> && rpp::constraint::observable<std::invoke_result_t<Fn, rpp::utils::extract_observable_type_t<TObservable>>>, "fn should return observable");
+            return std::forward<TObservable>(observable)
+                 | rpp::ops::map(std::move(m_fn))
+                 | std::move(m_concat);
+        }
+    };
+} // namespace rpp::operators::details
+
+namespace rpp::operators
+{
+    /**
+     * @brief Transform the items emitted by an Observable into Observables, then concatenates emissions from those into a single Observable without interleaving
+     *
+     * @marble concat_map
+            {
+                source observable                     : +--1-----2-----|
+                operator "concat_map: x=>just(x,x+1)" : +--12----23----|
+            }
+     *
+     * @details Actually it makes `map(callable)` and then `concat`.
+     *
+     * @param callable function that returns an observable for each item emitted by the source observable.
+     * @note `#include <rpp/operators/concat_map.hpp>`
+     *
+     * @ingroup transforming_operators
+     * @see https://reactivex.io/documentation/operators/flatmap.html
+     */
+    template<typename Fn>
+        requires (!utils::is_not_template_callable<Fn> || rpp::constraint::observable<std::invoke_result_t<Fn, rpp::utils::convertible_to_any>>)
+    auto concat_map(Fn&& callable)
+    {
+        return details::concat_map_t<std::decay_t<Fn>>{std::forward<Fn>(callable)};
+    }
+
+    /**
+     * @brief Same as rpp::operators::concat_map, but eagerly subscribes to up to `prefetch` upcoming observables returned by callable while current one is still emitting. Their values are buffered and emitted strictly in order, when observable becomes current.
+     *
+     * @details Useful for latency-heavy inner observables (e.g. network requests): they are executed in parallel, but results are obtained in the same order as source items.
+     *
+     * @warning Values of upcoming observables are buffered without limit till they become current.
+     *
+     * @par Performance notes:
+     * - 1 heap allocation for state and 1 heap allocation for buffer per inner observable
+     * - Acquiring mutex to buffer each value of inner observable
+     *
+     * @param callable function that returns an observable for each item emitted by the source observable.
+     * @param prefetch maximum amount of upcoming observables subscribed in addition to the current one. `0` means the same behavior as `concat_map(callable)`
+     * @note `#include <rpp/operators/concat_map.hpp>`
+     *
+     * @ingroup transforming_operators
+     * @see https://reactivex.io/documentation/operators/flatmap.html
+     */
+    template<typename Fn>
+        requires (!utils::is_not_template_callable<Fn> || rpp::constraint::observable<std::invoke_result_t<Fn, rpp::utils::convertible_to_any>>)
+    auto concat_map(Fn&& callable, size_t prefetch)
+    {
+        return details::concat_map_t<std::decay_t<Fn>, details::concat_prefetch_t>{std::forward<Fn>(callable), details::concat_prefetch_t{prefetch}};
+    }
+} // namespace rpp::operators
@@ -15,9 +15,11 @@
 #include <rpp/defs.hpp>
 #include <rpp/disposables/composite_disposable.hpp>
 #include <rpp/operators/details/strategy.hpp>
+#include <rpp/utils/ring_buffer.hpp>
 
+#include <atomic>
 #include <mutex>
-#include <queue>
+#include <utility>
 
 namespace rpp::operators::details
 {
@@ -51,9 +53,15 @@ namespace rpp::operators::details
         RPP_NO_UNIQUE_ADDRESS Worker   worker;
         rpp::schedulers::duration      delay;
 
-        std::mutex              mutex{};
-        std::queue<emission<T>> queue;
-        bool                    is_active{};
+        std::mutex                           mutex{};
+        rpp::utils::ring_buffer<emission<T>> queue{};
+        // time point of last queued emission: emissions are queued in order of their time points, so whole queue is ready when this one is ready
+        rpp::schedulers::time_point last_time_point{};
+        // set by producer which schedules draining, cleared by draining schedulable under mutex when queue is empty: single scheduling per idle->busy transition
+        std::atomic_flag drain_scheduled{};
+
+        // emissions moved out of queue by draining schedulable, accessed only by active schedulable
+        rpp::utils::ring_buffer<emission<T>> ready{};
     };
 
     template<rpp::constraint::observer Observer, typename Worker, rpp::details::disposables::constraint::disposables_container Container>
@@ -104,7 +112,8 @@ namespace rpp::operators::details
         template<typename TT>
         void emplace(TT&& value) const
         {
-            if (const auto tp = emplace_safe(std::forward<TT>(value)))
+            const auto tp = emplace_safe(std::forward<TT>(value));
+            if (tp && !disposable->drain_scheduled.test_and_set(std::memory_order::acq_rel))
             {
                 disposable->worker.schedule(
                     tp.value(),
@@ -116,51 +125,64 @@ namespace rpp::operators::details
         template<typename TT>
         std::optional<rpp::schedulers::time_point> emplace_safe(TT&& item) const
         {
-            std::lock_guard lock{disposable->mutex};
             if constexpr (ClearOnError && rpp::constraint::decayed_same_as<std::exception_ptr, TT>)
             {
-                disposable->queue = std::queue<emission<rpp::utils::extract_observer_type_t<Observer>>>{};
+                std::lock_guard lock{disposable->mutex};
+                disposable->queue.clear();
                 disposable->observer.on_error(std::forward<TT>(item));
                 return std::nullopt;
             }
             else
             {
-                const auto tp = disposable->worker.now() + disposable->delay;
-                disposable->queue.emplace(std::forward<TT>(item), tp);
-                if (!disposable->is_active)
-                {
-                    disposable->is_active = true;
-                    return tp;
-                }
-                return std::nullopt;
+                // emissions are serialized by observer's contract, so time points are still queued in order
+                const auto      tp = disposable->worker.now() + disposable->delay;
+                std::lock_guard lock{disposable->mutex};
+                disposable->queue.emplace_back(std::forward<TT>(item), tp);
+                disposable->last_time_point = tp;
+                return tp;
             }
         }
 
         static schedulers::optional_delay_to drain_queue(const std::shared_ptr<delay_disposable<Observer, Worker, Container>>& disposable)
         {
+            auto& ready = disposable->ready;
             while (true)
             {
-                std::unique_lock lock{disposable->mutex};
-                if (disposable->queue.empty())
                 {
-                    disposable->is_active = false;
-                    return std::nullopt;
+                    std::lock_guard lock{disposable->mutex};
+                    if (disposable->queue.empty())
+                    {
+                        // any emission queued after this point schedules new draining
+                        disposable->drain_scheduled.clear(std::memory_order::release);
+                        return std::nullopt;
+                    }
+
+                    const auto now = disposable->worker.now();
+                    if (disposable->queue.front().time_point > now)
+                        return schedulers::optional_delay_to{disposable->queue.front().time_point};
+
+                    // move out all ready emissions under single lock: whole queue is swapped when everything is ready (observe_on or burst of emissions)
+                    if (disposable->last_time_point <= now)
+                        std::swap(disposable->queue, ready);
+                    else
+                    {
+                        while (!disposable->queue.empty() && disposable->queue.front().time_point <= now)
+                        {
+                            ready.emplace_back(std::move(disposable->queue.front()));
+                            disposable->queue.pop_front();
+                        }
+                    }
                 }
 
-                auto& top = disposable->queue.front();
-                if (top.time_point > disposable->worker.now())
-                    return schedulers::optional_delay_to{top.time_point};
-
-                auto item = std::move(top.value);
-                disposable->queue.pop();
-                lock.unlock();
-
-                std::visit(rpp::utils::overloaded{[&](rpp::utils::extract_observer_type_t<Observer>&& v) { disposable->observer.on_next(std::move(v)); },
-                                                  [&](const std::exception_ptr& err) { disposable->observer.on_error(err); },
-                                                  [&](rpp::utils::none) {
-                                                      disposable->observer.on_completed();
-                                                  }},
-                           std::move(item));
+                for (; !ready.empty(); ready.pop_front())
+                {
+                    std::visit(rpp::utils::overloaded{[&](rpp::utils::extract_observer_type_t<Observer>&& v) { disposable->observer.on_next(std::move(v)); },
+                                                      [&](const std::exception_ptr& err) { disposable->observer.on_error(err); },
+                                                      [&](rpp::utils::none) {
+                                                          disposable->observer.on_completed();
+                                                      }},
+                               std::move(ready.front().value));
+                }
             }
         }
     };
@@ -16,23 +16,42 @@
 #include <rpp/disposables/composite_disposable.hpp>
 #include <rpp/operators/details/strategy.hpp>
 #include <rpp/schedulers/current_thread.hpp>
+#include <rpp/utils/emitter_loop.hpp>
 #include <rpp/utils/utils.hpp>
 
+#include <atomic>
 #include <memory>
 
 namespace rpp::operators::details
 {
-    template<rpp::constraint::observer Observer>
+    /**
+     * @brief Base state of combining operators. Emissions from all observables are serialized via emitter loop, so producers never block each other. Values are passed to `TDisposable::emit_next<I>` and never concurrently.
+     */
+    template<typename TDisposable, rpp::constraint::observer Observer, rpp::constraint::decayed_type... Args>
     class combining_disposable : public composite_disposable
     {
+        struct completed
+        {
+        };
+
     public:
-        explicit combining_disposable(Observer&& observer, size_t on_completed_needed)
-            : m_observer_with_mutex{std::move(observer)}
-            , m_on_completed_needed{on_completed_needed}
+        explicit combining_disposable(Observer&& observer)
+            : m_observer{std::move(observer)}
+        {
+        }
+
+        // called only once during creation of state before any emission
+        void set_upstream(const disposable_wrapper& d) { m_observer.set_upstream(d); }
+
+        template<size_t I, typename T>
+        void on_next(T&& v)
         {
+            m_emitter.emit(get_handler(), std::in_place_index<I>, std::forward<T>(v));
         }
 
-        rpp::utils::pointer_under_lock<Observer> get_observer_under_lock() { return m_observer_with_mutex; }
+        void on_error(const std::exception_ptr& err) { m_emitter.emit(get_handler(), std::in_place_index<sizeof...(Args)>, err); }
+
+        void on_completed() { m_emitter.emit(get_handler(), std::in_place_index<sizeof...(Args) + 1>, completed{}); }
 
         bool decrement_on_completed()
         {
@@ -40,10 +59,26 @@ namespace rpp::operators::details
             return m_on_completed_needed.fetch_sub(1, std::memory_order::seq_cst) == 1;
         }
 
+    protected:
+        const Observer& get_observer() const { return m_observer; }
+
     private:
-        rpp::utils::value_with_mutex<Observer> m_observer_with_mutex{};
+        auto get_handler()
+        {
+            return [this]<size_t I>(std::in_place_index_t<I>, auto&&... vals) {
+                if constexpr (I < sizeof...(Args))
+                    static_cast<TDisposable*>(this)->template emit_next<I>(std::forward<decltype(vals)>(vals)...);
+                else if constexpr (I == sizeof...(Args))
+                    m_observer.on_error(vals...);
+                else
+                    m_observer.on_completed();
+            };
+        }
 
-        std::atomic_size_t m_on_completed_needed;
+    private:
+        Observer                                                         m_observer;
+        rpp::utils::emitter_loop<Args..., std::exception_ptr, completed> m_emitter{};
+        std::atomic_size_t                                               m_on_completed_needed{sizeof...(Args)};
     };
 
     template<typename TDisposable>
@@ -66,21 +101,25 @@ namespace rpp::operators::details
 
         void on_error(const std::exception_ptr& err) const
         {
-            disposable->get_observer_under_lock()->on_error(err);
+            disposable->on_error(err);
         }
 
         void on_completed() const
         {
             if (disposable->decrement_on_completed())
-                disposable->get_observer_under_lock()->on_completed();
+                disposable->on_completed();
         }
     };
 
-    template<template<typename...> typename TDisposable, template<auto, typename...> typename TStrategy, typename TSelector, rpp::constraint::observable... TObservables>
+    /**
+     * @brief Combining operator over observables. `TOptions` are passed to constructor of disposable as is (use `rpp::utils::none` if operator has no options).
+     */
+    template<template<typename...> typename TDisposable, template<auto, typename...> typename TStrategy, typename TSelector, typename TOptions, rpp::constraint::observable... TObservables>
     struct combining_operator_t
     {
         RPP_NO_UNIQUE_ADDRESS rpp::utils::tuple<TObservables...> observables;
         RPP_NO_UNIQUE_ADDRESS TSelector                          selector;
+        RPP_NO_UNIQUE_ADDRESS TOptions                           options;
 
         template<rpp::constraint::decayed_type T>
         struct operator_traits
@@ -98,18 +137,18 @@ namespace rpp::operators::details
         template<rpp::constraint::decayed_type Type, rpp::constraint::observer Observer>
         auto lift(Observer&& observer) const
         {
-            return observables.apply(&subscribe_impl<Type, Observer>, std::forward<Observer>(observer), selector);
+            return observables.apply(&subscribe_impl<Type, Observer>, std::forward<Observer>(observer), selector, options);
         }
 
     private:
         template<rpp::constraint::decayed_type Type, rpp::constraint::observer Observer>
-        static auto subscribe_impl(Observer&& observer, const TSelector& selector, const TObservables&... observables)
+        static auto subscribe_impl(Observer&& observer, const TSelector& selector, const TOptions& options, const TObservables&... observables)
         {
             using Disposable = TDisposable<Observer, TSelector, Type, rpp::utils::extract_observable_type_t<TObservables>...>;
 
-            const auto disposable = disposable_wrapper_impl<Disposable>::make(std::forward<Observer>(observer), selector);
+            const auto disposable = disposable_wrapper_impl<Disposable>::make(std::forward<Observer>(observer), selector, options);
             auto       locked     = disposable.lock();
-            locked->get_observer_under_lock()->set_upstream(disposable.as_weak());
+            locked->set_upstream(disposable.as_weak());
 
             subscribe<std::decay_t<Type>>(locked, std::index_sequence_for<TObservables...>{}, observables...);
 
@@ -36,6 +36,8 @@ namespace rpp::operators::details
 
             void on_next(const Type& v) const { state->on_next(v); }
 
+            void on_next(Type&& v) const { state->on_next(std::move(v)); }
+
             void on_error(const std::exception_ptr& err) const { state->on_error(err); }
 
             void on_completed() const { state->on_completed(); }
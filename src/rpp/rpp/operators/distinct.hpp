@@ -16,7 +16,42 @@
 #include <rpp/operators/details/strategy.hpp>
 #include <rpp/utils/constraints.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <list>
+#include <unordered_map>
 #include <unordered_set>
+#include <vector>
+
+namespace rpp::operators
+{
+    /**
+     * @brief Bounds set of past values of rpp::operators::distinct: value is forgotten when it becomes least recently seen one over `max_count` values or wasn't seen during `duration`. Repeated value refreshes it.
+     *
+     * @ingroup filtering_operators
+     */
+    struct distinct_window
+    {
+        // maximum amount of remembered values, 0 means unlimited
+        size_t max_count{};
+        // value is remembered during this duration since it was seen last time, 0 means forever
+        rpp::schedulers::duration duration{};
+    };
+
+    /**
+     * @brief Probabilistic set of past values of rpp::operators::distinct based on Bloom filters with fixed memory footprint.
+     *
+     * @details Filter is sized for `expected_count` values with `false_positive_rate`. When `expected_count` values are inserted, filter becomes "previous" one and new empty filter is started, so values are remembered for at least `expected_count` next unique values and false positive rate stays bounded for infinite streams.
+     *
+     * @ingroup filtering_operators
+     */
+    struct distinct_bloom
+    {
+        size_t expected_count{};
+        double false_positive_rate = 0.01;
+    };
+} // namespace rpp::operators
 
 namespace rpp::operators::details
 {
@@ -47,6 +82,206 @@ namespace rpp::operators::details
         bool is_disposed() const { return observer.is_disposed(); }
     };
 
+    template<rpp::constraint::decayed_type Type, rpp::constraint::observer TObserver>
+    struct distinct_window_observer_strategy
+    {
+        static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::None;
+
+        RPP_NO_UNIQUE_ADDRESS TObserver observer;
+        distinct_window                 window;
+
+        struct entry
+        {
+            const Type*                 value;
+            rpp::schedulers::time_point last_seen;
+        };
+
+        // values ordered by last time seen: least recently seen value is the first one
+        mutable std::list<entry>                                              order{};
+        mutable std::unordered_map<Type, typename std::list<entry>::iterator> past_values{};
+
+        template<typename T>
+        void on_next(T&& v) const
+        {
+            const auto now = window.duration != rpp::schedulers::duration{} ? rpp::schedulers::clock_type::now() : rpp::schedulers::time_point{};
+            if (window.duration != rpp::schedulers::duration{})
+            {
+                while (!order.empty() && now - order.front().last_seen >= window.duration)
+                    forget_oldest();
+            }
+
+            if (const auto itr = past_values.find(v); itr != past_values.end())
+            {
+                itr->second->last_seen = now;
+                order.splice(order.end(), order, itr->second);
+                return;
+            }
+
+            if (window.max_count != 0 && past_values.size() >= window.max_count)
+                forget_oldest();
+
+            const auto itr = past_values.emplace(std::forward<T>(v), order.end()).first;
+            itr->second    = order.insert(order.end(), entry{&itr->first, now});
+            observer.on_next(itr->first);
+        }
+
+        void on_error(const std::exception_ptr& err) const { observer.on_error(err); }
+
+        void on_completed() const { observer.on_completed(); }
+
+        void set_upstream(const disposable_wrapper& d) { observer.set_upstream(d); }
+
+        bool is_disposed() const { return observer.is_disposed(); }
+
+    private:
+        void forget_oldest() const
+        {
+            past_values.erase(*order.front().value);
+            order.pop_front();
+        }
+    };
+
+    /**
+     * @brief Bloom filter over already calculated hashes: `k` bit positions are derived via double hashing.
+     */
+    class distinct_bloom_filter
+    {
+    public:
+        distinct_bloom_filter(size_t bits_count, size_t hashes_count)
+            : m_words((bits_count + 63) / 64)
+            , m_bits_count{m_words.size() * 64}
+            , m_hashes_count{hashes_count}
+        {
+        }
+
+        bool contains(uint64_t hash) const
+        {
+            for (size_t i = 0; i < m_hashes_count; ++i)
+            {
+                const auto bit = position(hash, i);
+                if ((m_words[bit / 64] & (uint64_t{1} << (bit % 64))) == 0)
+                    return false;
+            }
+            return true;
+        }
+
+        void insert(uint64_t hash)
+        {
+            for (size_t i = 0; i < m_hashes_count; ++i)
+            {
+                const auto bit = position(hash, i);
+                m_words[bit / 64] |= uint64_t{1} << (bit % 64);
+            }
+        }
+
+        void clear() { std::fill(m_words.begin(), m_words.end(), uint64_t{}); }
+
+    private:
+        size_t position(uint64_t hash, size_t i) const
+        {
+            // splitmix64 finalizer to obtain second independent hash, odd to visit different positions
+            uint64_t second = hash + 0x9e3779b97f4a7c15;
+            second          = (second ^ (second >> 30)) * 0xbf58476d1ce4e5b9;
+            second          = (second ^ (second >> 27)) * 0x94d049bb133111eb;
+            second          = (second ^ (second >> 31)) | 1;
+            return static_cast<size_t>((hash + i * second) % m_bits_count);
+        }
+
+    private:
+        std::vector<uint64_t> m_words;
+        size_t                m_bits_count;
+        size_t                m_hashes_count;
+    };
+
+    template<rpp::constraint::decayed_type Type, rpp::constraint::observer TObserver>
+    struct distinct_bloom_observer_strategy
+    {
+        static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::None;
+
+        distinct_bloom_observer_strategy(TObserver&& observer, const distinct_bloom& bloom)
+            : observer{std::move(observer)}
+            , expected_count{std::max(bloom.expected_count, size_t{1})}
+            , current{make_filter(expected_count, bloom.false_positive_rate)}
+            , previous{make_filter(expected_count, bloom.false_positive_rate)}
+        {
+        }
+
+        RPP_NO_UNIQUE_ADDRESS TObserver observer;
+        size_t                          expected_count;
+        // values are inserted into current filter, previous one is checked too till current is full
+        mutable distinct_bloom_filter current;
+        mutable distinct_bloom_filter previous;
+        mutable size_t                inserted_count{};
+
+        template<typename T>
+        void on_next(T&& v) const
+        {
+            const auto hash = static_cast<uint64_t>(std::hash<Type>{}(v));
+            if (current.contains(hash))
+                return;
+
+            if (previous.contains(hash))
+            {
+                // keep value remembered in current filter
+                insert(hash);
+                return;
+            }
+
+            insert(hash);
+            observer.on_next(std::forward<T>(v));
+        }
+
+        void on_error(const std::exception_ptr& err) const { observer.on_error(err); }
+
+        void on_completed() const { observer.on_completed(); }
+
+        void set_upstream(const disposable_wrapper& d) { observer.set_upstream(d); }
+
+        bool is_disposed() const { return observer.is_disposed(); }
+
+    private:
+        static distinct_bloom_filter make_filter(size_t expected_count, double false_positive_rate)
+        {
+            // optimal size of bloom filter: m = -n*ln(p)/ln(2)^2 bits and k = m/n*ln(2) hashes
+            const double ln2        = std::log(2.0);
+            const double rate       = std::clamp(false_positive_rate, 1e-12, 0.5);
+            const double bits_count = std::ceil(-static_cast<double>(expected_count) * std::log(rate) / (ln2 * ln2));
+            const auto   hashes     = std::max(size_t{1}, static_cast<size_t>(std::round(bits_count / static_cast<double>(expected_count) * ln2)));
+            return distinct_bloom_filter{static_cast<size_t>(bits_count), hashes};
+        }
+
+        void insert(uint64_t hash) const
+        {
+            current.insert(hash);
+            if (++inserted_count < expected_count)
+                return;
+
+            std::swap(current, previous);
+            current.clear();
+            inserted_count = 0;
+        }
+    };
+
+    template<rpp::constraint::decayed_type Options, template<typename, typename> typename Strategy>
+    struct bounded_distinct_t : lift_operator<bounded_distinct_t<Options, Strategy>, Options>
+    {
+        using lift_operator<bounded_distinct_t<Options, Strategy>, Options>::lift_operator;
+
+        template<rpp::constraint::decayed_type T>
+        struct operator_traits
+        {
+            static_assert(rpp::constraint::hashable<T>, "T is not hashable");
+
+            using result_type = T;
+
+            template<rpp::constraint::observer_of_type<result_type> TObserver>
+            using observer_strategy = Strategy<T, TObserver>;
+        };
+
+        template<rpp::details::observables::constraint::disposables_strategy Prev>
+        using updated_optimal_disposables_strategy = Prev;
+    };
+
     struct distinct_t : lift_operator<distinct_t>
     {
         using lift_operator<distinct_t>::lift_operator;
@@ -87,4 +322,42 @@ namespace rpp::operators
     {
         return details::distinct_t{};
     }
+
+    /**
+     * @brief Same as rpp::operators::distinct, but remembers only values seen recently according to `window`, so memory is bounded for infinite streams.
+     *
+     * @details Value forgotten by window is emitted again when seen next time.
+     *
+     * @par Performance notes:
+     * - each remembered value is stored in `std::unordered_map` plus list node ordered by last time seen
+     * - O(1) average per emission
+     *
+     * @param window maximum amount of remembered values and/or duration for which value is remembered since it was seen last time
+     *
+     * @ingroup filtering_operators
+     * @see https://reactivex.io/documentation/operators/distinct.html
+     */
+    inline auto distinct(const distinct_window& window)
+    {
+        return details::bounded_distinct_t<distinct_window, details::distinct_window_observer_strategy>{window};
+    }
+
+    /**
+     * @brief Same as rpp::operators::distinct, but remembers hashes of past values in Bloom filters of fixed size instead of values itself.
+     *
+     * @warning Filter is probabilistic: unique value can be filtered out as repeated with probability about `bloom.false_positive_rate`, while repeated value is never emitted while remembered.
+     *
+     * @par Performance notes:
+     * - no allocations after subscription: 2 filters of `-expected_count*ln(false_positive_rate)/ln(2)^2` bits each
+     * - `std::hash<T>` is calculated once per emission, bits positions are derived via double hashing
+     *
+     * @param bloom expected amount of unique values to remember and false positive rate
+     *
+     * @ingroup filtering_operators
+     * @see https://reactivex.io/documentation/operators/distinct.html
+     */
+    inline auto distinct(const distinct_bloom& bloom)
+    {
+        return details::bounded_distinct_t<distinct_bloom, details::distinct_bloom_observer_strategy>{bloom};
+    }
 } // namespace rpp::operators
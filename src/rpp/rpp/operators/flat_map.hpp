@@ -16,10 +16,11 @@
 
 namespace rpp::operators::details
 {
-    template<rpp::constraint::decayed_type Fn>
+    template<rpp::constraint::decayed_type Fn, rpp::constraint::decayed_type Merge = merge_t>
     struct flat_map_t
     {
-        RPP_NO_UNIQUE_ADDRESS Fn m_fn;
+        RPP_NO_UNIQUE_ADDRESS Fn    m_fn;
+        RPP_NO_UNIQUE_ADDRESS Merge m_merge{};
 
         template<rpp::constraint::observable TObservable>
         auto operator()(TObservable&& observable) const &
@@ -27,7 +28,7 @@ namespace rpp::operators::details
             static_assert(std::invocable<Fn, rpp::utils::extract_observable_type_t<TObservable>> && rpp::constraint::observable<std::invoke_result_t<Fn, rpp::utils::extract_observable_type_t<TObservable>>>, "fn should return observable");
             return std::forward<TObservable>(observable)
                  | rpp::ops::map(m_fn)
-                 | rpp::ops::merge();
+                 | m_merge;
         }
 
         template<rpp::constraint::observable TObservable>
@@ -36,7 +37,7 @@ namespace rpp::operators::details
             static_assert(std::invocable<Fn, rpp::utils::extract_observable_type_t<TObservable>> && rpp::constraint::observable<std::invoke_result_t<Fn, rpp::utils::extract_observable_type_t<TObservable>>>, "fn should return observable");
             return std::forward<TObservable>(observable)
                  | rpp::ops::map(std::move(m_fn))
-                 | rpp::ops::merge();
+                 | std::move(m_merge);
         }
     };
 
@@ -70,4 +71,23 @@ namespace rpp::operators
         return details::flat_map_t<std::decay_t<Fn>>{std::forward<Fn>(callable)};
     }
 
+    /**
+     * @brief Same as rpp::operators::flat_map, but subscribes to no more than `max_concurrent` observables returned by callable at the same time. Other observables are queued till any active one completes.
+     *
+     * @details Actually it makes `map(callable)` and then `merge(max_concurrent)`.
+     *
+     * @param callable function that returns an observable for each item emitted by the source observable.
+     * @param max_concurrent maximum amount of inner observables subscribed at the same time. Values less than 1 are treated as 1.
+     * @note `#include <rpp/operators/flat_map.hpp>`
+     *
+     * @ingroup transforming_operators
+     * @see https://reactivex.io/documentation/operators/flatmap.html
+     */
+    template<typename Fn>
+        requires (!utils::is_not_template_callable<Fn> || rpp::constraint::observable<std::invoke_result_t<Fn, rpp::utils::convertible_to_any>>)
+    auto flat_map(Fn&& callable, size_t max_concurrent)
+    {
+        return details::flat_map_t<std::decay_t<Fn>, details::merge_limited_t>{std::forward<Fn>(callable), details::merge_limited_t{max_concurrent}};
+    }
+
 } // namespace rpp::operators
@@ -20,12 +20,43 @@
 
 namespace rpp::operators
 {
+    /**
+     * @brief Policy applied by `on_backpressure_buffer` when new value arrives while the queue is full
+     *
+     * @ingroup utility_operators
+     */
+    enum class backpressure_overflow : uint8_t
+    {
+        DropNewest, // drop new value
+        DropOldest, // drop the oldest queued value and queue new one
+        Error,      // clear queue, dispose source and emit `rpp::utils::buffer_overflow`
+        Block       // block producer till observer takes value from the queue
+    };
+
+    struct group_by_eviction;
+
+    struct zip_options;
+
     auto as_blocking();
 
     auto buffer(size_t count);
 
+    template<rpp::schedulers::constraint::scheduler Scheduler>
+    auto buffer_with_time(rpp::schedulers::duration period, Scheduler&& scheduler);
+
+    template<rpp::schedulers::constraint::scheduler Scheduler>
+    auto buffer_with_time_or_count(rpp::schedulers::duration period, size_t count, Scheduler&& scheduler);
+
     auto concat();
 
+    template<typename Fn>
+        requires (!utils::is_not_template_callable<Fn> || rpp::constraint::observable<std::invoke_result_t<Fn, rpp::utils::convertible_to_any>>)
+    auto concat_map(Fn&& callable);
+
+    template<typename Fn>
+        requires (!utils::is_not_template_callable<Fn> || rpp::constraint::observable<std::invoke_result_t<Fn, rpp::utils::convertible_to_any>>)
+    auto concat_map(Fn&& callable, size_t prefetch);
+
     template<typename TSelector, rpp::constraint::observable TObservable, rpp::constraint::observable... TObservables>
         requires (!rpp::constraint::observable<TSelector> && (!utils::is_not_template_callable<TSelector> || std::invocable<TSelector, rpp::utils::convertible_to_any, utils::extract_observable_type_t<TObservable>, utils::extract_observable_type_t<TObservables>...>))
     auto combine_latest(TSelector&& selector, TObservable&& observable, TObservables&&... observables);
@@ -41,6 +72,12 @@ namespace rpp::operators
 
     auto distinct();
 
+    struct distinct_window;
+    auto distinct(const distinct_window& window);
+
+    struct distinct_bloom;
+    auto distinct(const distinct_bloom& bloom);
+
     template<typename EqualityFn = rpp::utils::equal_to>
         requires (!utils::is_not_template_callable<EqualityFn> || std::same_as<bool, std::invoke_result_t<EqualityFn, rpp::utils::convertible_to_any, rpp::utils::convertible_to_any>>)
     auto distinct_until_changed(EqualityFn&& equality_fn = {});
@@ -60,6 +97,10 @@ namespace rpp::operators
         requires (!utils::is_not_template_callable<Fn> || rpp::constraint::observable<std::invoke_result_t<Fn, rpp::utils::convertible_to_any>>)
     auto flat_map(Fn&& callable);
 
+    template<typename Fn>
+        requires (!utils::is_not_template_callable<Fn> || rpp::constraint::observable<std::invoke_result_t<Fn, rpp::utils::convertible_to_any>>)
+    auto flat_map(Fn&& callable, size_t max_concurrent);
+
     template<typename KeySelector,
              typename ValueSelector = std::identity,
              typename KeyComparator = rpp::utils::less>
@@ -67,6 +108,14 @@ namespace rpp::operators
             (!utils::is_not_template_callable<KeySelector> || !std::same_as<void, std::invoke_result_t<KeySelector, rpp::utils::convertible_to_any>>) && (!utils::is_not_template_callable<ValueSelector> || !std::same_as<void, std::invoke_result_t<ValueSelector, rpp::utils::convertible_to_any>>) && (!utils::is_not_template_callable<KeyComparator> || std::strict_weak_order<KeyComparator, rpp::utils::convertible_to_any, rpp::utils::convertible_to_any>))
     auto group_by(KeySelector&& key_selector, ValueSelector&& value_selector = {}, KeyComparator&& comparator = {});
 
+    template<typename KeySelector,
+             typename ValueSelector = std::identity,
+             typename KeyHash       = rpp::utils::hash,
+             typename KeyEqual      = rpp::utils::equal_to>
+        requires (
+            (!utils::is_not_template_callable<KeySelector> || !std::same_as<void, std::invoke_result_t<KeySelector, rpp::utils::convertible_to_any>>) && (!utils::is_not_template_callable<ValueSelector> || !std::same_as<void, std::invoke_result_t<ValueSelector, rpp::utils::convertible_to_any>>))
+    auto hash_group_by(KeySelector&& key_selector, ValueSelector&& value_selector = {}, group_by_eviction eviction = {}, KeyHash&& hash = {}, KeyEqual&& equal = {});
+
     auto last();
 
     template<typename Fn>
@@ -83,10 +132,32 @@ namespace rpp::operators
         requires constraint::observables_of_same_type<std::decay_t<TObservable>, std::decay_t<TObservables>...>
     auto merge_with(TObservable&& observable, TObservables&&... observables);
     auto merge();
+    auto merge(size_t max_concurrent);
 
     template<rpp::schedulers::constraint::scheduler Scheduler>
     auto observe_on(Scheduler&& scheduler, rpp::schedulers::duration delay_duration = {});
 
+    template<rpp::schedulers::constraint::scheduler Scheduler, std::invocable<size_t> OnDropFn = rpp::utils::empty_function_t<size_t>>
+    auto on_backpressure_buffer(size_t capacity, Scheduler&& scheduler, backpressure_overflow overflow = backpressure_overflow::Error, OnDropFn&& on_drop = {});
+
+    template<rpp::schedulers::constraint::scheduler Scheduler, std::invocable<size_t> OnDropFn = rpp::utils::empty_function_t<size_t>>
+    auto on_backpressure_drop(Scheduler&& scheduler, OnDropFn&& on_drop = {});
+
+    template<rpp::schedulers::constraint::scheduler Scheduler, std::invocable<size_t> OnDropFn = rpp::utils::empty_function_t<size_t>>
+    auto on_backpressure_latest(Scheduler&& scheduler, OnDropFn&& on_drop = {});
+
+    template<typename Fn, rpp::schedulers::constraint::scheduler Scheduler>
+    auto parallel_map(Fn&& fn, Scheduler&& scheduler, size_t max_in_flight);
+
+    template<typename Fn, rpp::schedulers::constraint::scheduler Scheduler>
+    auto parallel_map_unordered(Fn&& fn, Scheduler&& scheduler, size_t max_in_flight);
+
+    template<typename Seed, typename Combine, typename Merge, rpp::schedulers::constraint::scheduler Scheduler>
+    auto parallel_reduce(Seed&& seed, Combine&& combine, Merge&& merge, Scheduler&& scheduler, size_t chunk_size = 1024);
+
+    template<typename KeyFn, rpp::schedulers::constraint::scheduler Scheduler, typename Fn>
+    auto partition_by(KeyFn&& key_fn, size_t partitions, Scheduler&& scheduler, Fn&& fn, size_t lane_capacity = 1024);
+
     auto publish();
 
     template<typename Seed, typename Accumulator>
@@ -115,6 +186,10 @@ namespace rpp::operators
 
     auto skip(size_t count);
 
+    struct sliding_window;
+    template<typename Monoid>
+    auto sliding_aggregate(const sliding_window& window, Monoid&& monoid);
+
     template<rpp::constraint::observable TObservable, rpp::constraint::observable... TObservables>
         requires constraint::observables_of_same_type<std::decay_t<TObservable>, std::decay_t<TObservables>...>
     auto start_with(TObservable&& observable, TObservables&&... observables);
@@ -197,16 +272,29 @@ namespace rpp::operators
 
     auto window(size_t count);
 
+    template<rpp::schedulers::constraint::scheduler Scheduler>
+    auto window_with_time(rpp::schedulers::duration span, rpp::schedulers::duration shift, Scheduler&& scheduler);
+
+    template<rpp::schedulers::constraint::scheduler Scheduler>
+    auto window_with_time(rpp::schedulers::duration span, Scheduler&& scheduler);
+
     template<rpp::constraint::observable TOpeningsObservable, typename TClosingsSelectorFn>
         requires rpp::constraint::observable<std::invoke_result_t<TClosingsSelectorFn, rpp::utils::extract_observable_type_t<TOpeningsObservable>>>
     auto window_toggle(TOpeningsObservable&& openings, TClosingsSelectorFn&& closings_selector);
 
     template<typename TSelector, rpp::constraint::observable TObservable, rpp::constraint::observable... TObservables>
-        requires (!rpp::constraint::observable<TSelector> && (!utils::is_not_template_callable<TSelector> || std::invocable<TSelector, rpp::utils::convertible_to_any, utils::extract_observable_type_t<TObservable>, utils::extract_observable_type_t<TObservables>...>))
+        requires (!rpp::constraint::observable<TSelector> && !std::same_as<std::decay_t<TSelector>, zip_options> && (!utils::is_not_template_callable<TSelector> || std::invocable<TSelector, rpp::utils::convertible_to_any, utils::extract_observable_type_t<TObservable>, utils::extract_observable_type_t<TObservables>...>))
     auto zip(TSelector&& selector, TObservable&& observable, TObservables&&... observables);
 
     template<rpp::constraint::observable TObservable, rpp::constraint::observable... TObservables>
     auto zip(TObservable&& observable, TObservables&&... observables);
+
+    template<typename TSelector, rpp::constraint::observable TObservable, rpp::constraint::observable... TObservables>
+        requires (!rpp::constraint::observable<TSelector> && (!utils::is_not_template_callable<TSelector> || std::invocable<TSelector, rpp::utils::convertible_to_any, utils::extract_observable_type_t<TObservable>, utils::extract_observable_type_t<TObservables>...>))
+    auto zip(const zip_options& options, TSelector&& selector, TObservable&& observable, TObservables&&... observables);
+
+    template<rpp::constraint::observable TObservable, rpp::constraint::observable... TObservables>
+    auto zip(const zip_options& options, TObservable&& observable, TObservables&&... observables);
 } // namespace rpp::operators
 
 namespace rpp
@@ -18,8 +18,26 @@
 #include <rpp/subjects/publish_subject.hpp>
 #include <rpp/utils/function_traits.hpp>
 
+#include <list>
 #include <map>
 #include <type_traits>
+#include <unordered_map>
+
+namespace rpp::operators
+{
+    /**
+     * @brief Eviction policy of rpp::operators::hash_group_by. Evicted group is completed and removed, so next value with same key starts new group.
+     *
+     * @ingroup transforming_operators
+     */
+    struct group_by_eviction
+    {
+        // maximum amount of alive groups, least recently used group is evicted when new one exceeds it. 0 means unlimited
+        size_t max_groups{};
+        // group without new values for this duration is evicted. Checked on each emission of original observable. 0 means disabled
+        rpp::schedulers::duration idle_timeout{};
+    };
+} // namespace rpp::operators
 
 namespace rpp::operators::details
 {
@@ -137,6 +155,128 @@ namespace rpp::operators::details
         }
     };
 
+    template<rpp::constraint::decayed_type T, rpp::constraint::observer TObserver, rpp::constraint::decayed_type KeySelector, rpp::constraint::decayed_type ValueSelector, rpp::constraint::decayed_type KeyHash, rpp::constraint::decayed_type KeyEqual>
+    struct hash_group_by_observer_strategy
+    {
+        static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::None;
+
+        using TKey = rpp::utils::decayed_invoke_result_t<KeySelector, T>;
+        using Type = rpp::utils::decayed_invoke_result_t<ValueSelector, T>;
+
+        RPP_NO_UNIQUE_ADDRESS TObserver     observer;
+        RPP_NO_UNIQUE_ADDRESS KeySelector   key_selector;
+        RPP_NO_UNIQUE_ADDRESS ValueSelector value_selector;
+        group_by_eviction                   eviction;
+        RPP_NO_UNIQUE_ADDRESS KeyHash       hash;
+        RPP_NO_UNIQUE_ADDRESS KeyEqual      equal;
+
+        using subject_observer = decltype(std::declval<subjects::publish_subject<Type>>().get_observer());
+
+        struct group
+        {
+            TKey                        key;
+            subject_observer            observer;
+            rpp::disposable_wrapper     subject_disposable;
+            rpp::schedulers::time_point last_emission;
+        };
+
+        // groups ordered by last emission: least recently used group is the first one
+        mutable std::list<group>                                                                 groups{};
+        mutable std::unordered_map<TKey, typename std::list<group>::iterator, KeyHash, KeyEqual> key_to_group{0, hash, equal};
+        std::shared_ptr<refcount_disposable>                                                     disposable = [&] {
+            auto ptr = disposable_wrapper_impl<refcount_disposable>::make().lock();
+            observer.set_upstream(ptr->add_ref());
+            return ptr;
+        }();
+
+        void set_upstream(const rpp::disposable_wrapper& d) const
+        {
+            disposable->add(d);
+        }
+
+        bool is_disposed() const
+        {
+            return disposable->is_disposed();
+        }
+
+        template<rpp::constraint::decayed_same_as<T> TT>
+        void on_next(TT&& val) const
+        {
+            const auto now = eviction.idle_timeout != rpp::schedulers::duration{} ? rpp::schedulers::clock_type::now() : rpp::schedulers::time_point{};
+            evict_idle(now);
+
+            const auto subject_observer = deduce_observer(val, now);
+            if (subject_observer && !subject_observer->is_disposed())
+                subject_observer->on_next(value_selector(std::forward<TT>(val)));
+        }
+
+        void on_error(const std::exception_ptr& err) const
+        {
+            for (const auto& g : groups)
+                g.observer.on_error(err);
+
+            observer.on_error(err);
+        }
+
+        void on_completed() const
+        {
+            for (const auto& g : groups)
+                g.observer.on_completed();
+
+            observer.on_completed();
+        }
+
+    private:
+        template<rpp::constraint::decayed_same_as<T> TT>
+        const subject_observer* deduce_observer(const TT& val, rpp::schedulers::time_point now) const
+        {
+            auto key = key_selector(utils::as_const(val));
+
+            if (const auto itr = key_to_group.find(key); itr != key_to_group.cend())
+            {
+                itr->second->last_emission = now;
+                groups.splice(groups.end(), groups, itr->second);
+                return &itr->second->observer;
+            }
+
+            if (observer.is_disposed())
+                return nullptr;
+
+            if (eviction.max_groups != 0 && groups.size() >= eviction.max_groups)
+                evict(groups.begin());
+
+            const subjects::publish_subject<Type> subj{};
+
+            disposable->add(subj.get_disposable().as_weak());
+            observer.on_next(rpp::grouped_observable_group_by<TKey, Type>{
+                key,
+                group_by_observable_strategy<Type>{subj, disposable}});
+
+            const auto itr = groups.insert(groups.end(), group{std::move(key), subj.get_observer(), subj.get_disposable(), now});
+            key_to_group.emplace(itr->key, itr);
+            return &itr->observer;
+        }
+
+        void evict_idle(rpp::schedulers::time_point now) const
+        {
+            if (eviction.idle_timeout == rpp::schedulers::duration{})
+                return;
+
+            while (!groups.empty() && now - groups.front().last_emission >= eviction.idle_timeout)
+                evict(groups.begin());
+        }
+
+        void evict(typename std::list<group>::iterator itr) const
+        {
+            const auto evicted = std::move(*itr);
+            key_to_group.erase(evicted.key);
+            groups.erase(itr);
+
+            disposable->remove(evicted.subject_disposable);
+            evicted.observer.on_completed();
+        }
+    };
+
     template<rpp::constraint::decayed_type T>
     struct group_by_observable_strategy
     {
@@ -180,6 +320,29 @@ namespace rpp::operators::details
         template<rpp::details::observables::constraint::disposables_strategy Prev>
         using updated_optimal_disposables_strategy = rpp::details::observables::fixed_disposables_strategy<1>;
     };
+
+    template<rpp::constraint::decayed_type KeySelector, rpp::constraint::decayed_type ValueSelector, rpp::constraint::decayed_type KeyHash, rpp::constraint::decayed_type KeyEqual>
+    struct hash_group_by_t : lift_operator<hash_group_by_t<KeySelector, ValueSelector, KeyHash, KeyEqual>, KeySelector, ValueSelector, group_by_eviction, KeyHash, KeyEqual>
+    {
+        using operators::details::lift_operator<hash_group_by_t<KeySelector, ValueSelector, KeyHash, KeyEqual>, KeySelector, ValueSelector, group_by_eviction, KeyHash, KeyEqual>::lift_operator;
+
+        template<rpp::constraint::decayed_type T>
+        struct operator_traits
+        {
+            static_assert(!std::same_as<void, std::invoke_result_t<KeySelector, T>>, "KeySelector is not invocacble with T");
+            static_assert(!std::same_as<void, std::invoke_result_t<ValueSelector, T>>, "ValueSelector is not invocable with T");
+            static_assert(std::is_invocable_r_v<size_t, KeyHash, rpp::utils::decayed_invoke_result_t<KeySelector, T>>, "KeyHash is not invocable with result of KeySelector");
+            static_assert(std::equivalence_relation<KeyEqual, rpp::utils::decayed_invoke_result_t<KeySelector, T>, rpp::utils::decayed_invoke_result_t<KeySelector, T>>, "KeyEqual is not invocable with result of KeySelector");
+
+            using result_type = grouped_observable<utils::decayed_invoke_result_t<KeySelector, T>, rpp::utils::decayed_invoke_result_t<ValueSelector, T>, group_by_observable_strategy<utils::decayed_invoke_result_t<ValueSelector, T>>>;
+
+            template<rpp::constraint::observer_of_type<result_type> TObserver>
+            using observer_strategy = hash_group_by_observer_strategy<T, TObserver, KeySelector, ValueSelector, KeyHash, KeyEqual>;
+        };
+
+        template<rpp::details::observables::constraint::disposables_strategy Prev>
+        using updated_optimal_disposables_strategy = rpp::details::observables::fixed_disposables_strategy<1>;
+    };
 } // namespace rpp::operators::details
 
 namespace rpp::operators
@@ -225,4 +388,42 @@ namespace rpp::operators
             std::forward<ValueSelector>(value_selector),
             std::forward<KeyComparator>(comparator)};
     }
+
+    /**
+     * @brief Same as rpp::operators::group_by, but keeps groups in hash map and evicts them according to `eviction` policy, so can run indefinitely over unbounded amount of keys (for example, session ids).
+     *
+     * @details Evicted group is completed and forgotten: next value with the same key creates new group and emits new grouped observable.
+     * @details Idle groups are evicted lazily during emissions of original observable, no scheduler is involved.
+     *
+     * @par Performance notes:
+     * - O(1) average lookup of group per emission
+     * - each group additionally keeps key twice (in list ordered by last emission and in hash map)
+     * - eviction of group is linear over amount of alive groups due to removal of its disposable
+     *
+     * @param key_selector Function which determines key for provided item
+     * @param value_selector Function which determines value to be emitted to grouped observable
+     * @param eviction Maximum amount of alive groups and/or idle timeout after which group is completed and evicted
+     * @param hash Function to hash keys
+     * @param equal Function to compare keys for equality
+     *
+     * @note `#include <rpp/operators/group_by.hpp>`
+     *
+     * @ingroup transforming_operators
+     * @see https://reactivex.io/documentation/operators/groupby.html
+     */
+    template<typename KeySelector,
+             typename ValueSelector,
+             typename KeyHash,
+             typename KeyEqual>
+        requires (
+            (!utils::is_not_template_callable<KeySelector> || !std::same_as<void, std::invoke_result_t<KeySelector, rpp::utils::convertible_to_any>>) && (!utils::is_not_template_callable<ValueSelector> || !std::same_as<void, std::invoke_result_t<ValueSelector, rpp::utils::convertible_to_any>>))
+    auto hash_group_by(KeySelector&& key_selector, ValueSelector&& value_selector, group_by_eviction eviction, KeyHash&& hash, KeyEqual&& equal)
+    {
+        return details::hash_group_by_t<std::decay_t<KeySelector>, std::decay_t<ValueSelector>, std::decay_t<KeyHash>, std::decay_t<KeyEqual>>{
+            std::forward<KeySelector>(key_selector),
+            std::forward<ValueSelector>(value_selector),
+            eviction,
+            std::forward<KeyHash>(hash),
+            std::forward<KeyEqual>(equal)};
+    }
 } // namespace rpp::operators
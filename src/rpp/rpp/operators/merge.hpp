@@ -16,16 +16,26 @@
 #include <rpp/disposables/composite_disposable.hpp>
 #include <rpp/operators/details/strategy.hpp>
 #include <rpp/schedulers/current_thread.hpp>
+#include <rpp/utils/emitter_loop.hpp>
 #include <rpp/utils/tuple.hpp>
 #include <rpp/utils/utils.hpp>
 
+#include <algorithm>
 #include <atomic>
+#include <optional>
+#include <queue>
 
 namespace rpp::operators::details
 {
     template<rpp::constraint::observer TObserver>
-    class merge_disposable final : public composite_disposable
+    class merge_disposable : public composite_disposable
     {
+        using Type = rpp::utils::extract_observer_type_t<TObserver>;
+
+        struct completed
+        {
+        };
+
     public:
         merge_disposable(TObserver&& observer)
             : m_observer(std::move(observer))
@@ -38,23 +48,48 @@ namespace rpp::operators::details
         // just need atomicity, not guarding anything
         bool decrement_on_completed() { return m_on_completed_needed.fetch_sub(1, std::memory_order::seq_cst) == 1; }
 
-        rpp::utils::pointer_under_lock<TObserver> get_observer_under_lock() { return m_observer; }
+        // called only once during creation of state before any emission
+        void set_upstream(const disposable_wrapper& d) { m_observer.set_upstream(d); }
+
+        template<typename T>
+        void on_next(T&& v)
+        {
+            m_emitter.emit(get_handler(), std::in_place_index<0>, std::forward<T>(v));
+        }
+
+        void on_error(const std::exception_ptr& err) { m_emitter.emit(get_handler(), std::in_place_index<1>, err); }
+
+        void on_completed() { m_emitter.emit(get_handler(), std::in_place_index<2>, completed{}); }
+
+    private:
+        auto get_handler() const
+        {
+            return [this]<size_t I>(std::in_place_index_t<I>, auto&&... vals) {
+                if constexpr (I == 0)
+                    m_observer.on_next(std::forward<decltype(vals)>(vals)...);
+                else if constexpr (I == 1)
+                    m_observer.on_error(vals...);
+                else
+                    m_observer.on_completed();
+            };
+        }
 
     private:
-        rpp::utils::value_with_mutex<TObserver> m_observer{};
-        std::atomic_size_t                      m_on_completed_needed{1};
+        TObserver                                                     m_observer;
+        rpp::utils::emitter_loop<Type, std::exception_ptr, completed> m_emitter{};
+        std::atomic_size_t                                            m_on_completed_needed{1};
     };
 
-    template<rpp::constraint::observer TObserver>
+    template<typename TDisposable>
     struct merge_observer_base_strategy
     {
         static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::Boolean;
-        merge_observer_base_strategy(std::shared_ptr<merge_disposable<TObserver>>&& disposable)
+        merge_observer_base_strategy(std::shared_ptr<TDisposable>&& disposable)
             : m_disposable{std::move(disposable)}
         {
         }
 
-        merge_observer_base_strategy(const std::shared_ptr<merge_disposable<TObserver>>& disposable)
+        merge_observer_base_strategy(const std::shared_ptr<TDisposable>& disposable)
             : m_disposable{disposable}
         {
         }
@@ -72,14 +107,14 @@ namespace rpp::operators::details
 
         void on_error(const std::exception_ptr& err) const
         {
-            m_disposable->get_observer_under_lock()->on_error(err);
+            m_disposable->on_error(err);
         }
 
         void on_completed() const
         {
             if (m_disposable->decrement_on_completed())
             {
-                m_disposable->get_observer_under_lock()->on_completed();
+                m_disposable->on_completed();
             }
             else
             {
@@ -92,36 +127,38 @@ namespace rpp::operators::details
         }
 
     protected:
-        std::shared_ptr<merge_disposable<TObserver>> m_disposable;
+        std::shared_ptr<TDisposable>                 m_disposable;
         mutable std::vector<rpp::disposable_wrapper> m_disposables{};
     };
 
-    template<rpp::constraint::observer TObserver>
-    struct merge_observer_inner_strategy final : public merge_observer_base_strategy<TObserver>
+    template<typename TDisposable>
+    struct merge_observer_inner_strategy final : public merge_observer_base_strategy<TDisposable>
     {
-        using merge_observer_base_strategy<TObserver>::merge_observer_base_strategy;
+        using merge_observer_base_strategy<TDisposable>::merge_observer_base_strategy;
 
         template<typename T>
         void on_next(T&& v) const
         {
-            merge_observer_base_strategy<TObserver>::m_disposable->get_observer_under_lock()->on_next(std::forward<T>(v));
+            merge_observer_base_strategy<TDisposable>::m_disposable->on_next(std::forward<T>(v));
         }
     };
 
     template<rpp::constraint::observer TObserver>
-    class merge_observer_strategy final : public merge_observer_base_strategy<TObserver>
+    class merge_observer_strategy final : public merge_observer_base_strategy<merge_disposable<TObserver>>
     {
+        using base = merge_observer_base_strategy<merge_disposable<TObserver>>;
+
     public:
         explicit merge_observer_strategy(TObserver&& observer)
-            : merge_observer_base_strategy<TObserver>{init_state(std::move(observer))}
+            : base{init_state(std::move(observer))}
         {
         }
 
         template<typename T>
         void on_next(T&& v) const
         {
-            merge_observer_base_strategy<TObserver>::m_disposable->increment_on_completed();
-            std::forward<T>(v).subscribe(rpp::observer<rpp::utils::extract_observer_type_t<TObserver>, merge_observer_inner_strategy<TObserver>>{merge_observer_inner_strategy<TObserver>{merge_observer_base_strategy<TObserver>::m_disposable}});
+            base::m_disposable->increment_on_completed();
+            std::forward<T>(v).subscribe(rpp::observer<rpp::utils::extract_observer_type_t<TObserver>, merge_observer_inner_strategy<merge_disposable<TObserver>>>{base::m_disposable});
         }
 
     private:
@@ -129,7 +166,136 @@ namespace rpp::operators::details
         {
             const auto d   = disposable_wrapper_impl<merge_disposable<TObserver>>::make(std::move(observer));
             auto       ptr = d.lock();
-            ptr->get_observer_under_lock()->set_upstream(d.as_weak());
+            ptr->set_upstream(d.as_weak());
+            return ptr;
+        }
+    };
+
+    template<rpp::constraint::observable TObservable, rpp::constraint::observer TObserver>
+    struct merge_limited_observer_inner_strategy;
+
+    /**
+     * @brief State of merge with limited amount of concurrently subscribed inner observables: observables exceeding limit are queued till some inner observable completes.
+     */
+    template<rpp::constraint::observable TObservable, rpp::constraint::observer TObserver>
+    class merge_limited_disposable final : public merge_disposable<TObserver>
+    {
+        struct pending_observables
+        {
+            std::queue<TObservable> queue{};
+            size_t                  active{};
+        };
+
+    public:
+        merge_limited_disposable(TObserver&& observer, size_t max_concurrent)
+            : merge_disposable<TObserver>{std::move(observer)}
+            , m_max_concurrent{std::max(size_t{1}, max_concurrent)}
+        {
+        }
+
+        template<rpp::constraint::decayed_same_as<TObservable> T>
+        void push(T&& observable)
+        {
+            m_pending.lock()->queue.push(std::forward<T>(observable));
+        }
+
+        void release_slot()
+        {
+            --m_pending.lock()->active;
+        }
+
+        /**
+         * @brief Subscribes queued observables while there are free slots. Only one thread drains at a time, others just notify it, so inner observable completing during subscription doesn't cause recursion.
+         */
+        static void drain(const std::shared_ptr<merge_limited_disposable>& state)
+        {
+            if (state->m_drain_wip.fetch_add(1, std::memory_order::acq_rel) != 0)
+                return;
+
+            size_t missed = 1;
+            while (missed != 0)
+            {
+                while (!state->is_disposed())
+                {
+                    auto observable = state->acquire_slot();
+                    if (!observable)
+                        break;
+
+                    std::move(observable).value().subscribe(rpp::observer<rpp::utils::extract_observer_type_t<TObserver>, merge_limited_observer_inner_strategy<TObservable, TObserver>>{state});
+                }
+                missed = state->m_drain_wip.fetch_sub(missed, std::memory_order::acq_rel) - missed;
+            }
+        }
+
+    private:
+        std::optional<TObservable> acquire_slot()
+        {
+            auto pending = m_pending.lock();
+            if (pending->queue.empty() || pending->active >= m_max_concurrent)
+                return std::nullopt;
+
+            ++pending->active;
+            std::optional<TObservable> observable{std::move(pending->queue.front())};
+            pending->queue.pop();
+            return observable;
+        }
+
+        void composite_dispose_impl(interface_disposable::Mode) noexcept override
+        {
+            m_pending.lock()->queue = {};
+        }
+
+    private:
+        rpp::utils::value_with_mutex<pending_observables> m_pending{};
+        std::atomic_size_t                                m_drain_wip{};
+        const size_t                                      m_max_concurrent;
+    };
+
+    template<rpp::constraint::observable TObservable, rpp::constraint::observer TObserver>
+    struct merge_limited_observer_inner_strategy final : public merge_observer_base_strategy<merge_limited_disposable<TObservable, TObserver>>
+    {
+        using base = merge_observer_base_strategy<merge_limited_disposable<TObservable, TObserver>>;
+        using base::base;
+
+        template<typename T>
+        void on_next(T&& v) const
+        {
+            base::m_disposable->on_next(std::forward<T>(v));
+        }
+
+        void on_completed() const
+        {
+            base::on_completed();
+            base::m_disposable->release_slot();
+            merge_limited_disposable<TObservable, TObserver>::drain(base::m_disposable);
+        }
+    };
+
+    template<rpp::constraint::observable TObservable, rpp::constraint::observer TObserver>
+    class merge_limited_observer_strategy final : public merge_observer_base_strategy<merge_limited_disposable<TObservable, TObserver>>
+    {
+        using base = merge_observer_base_strategy<merge_limited_disposable<TObservable, TObserver>>;
+
+    public:
+        merge_limited_observer_strategy(TObserver&& observer, size_t max_concurrent)
+            : base{init_state(std::move(observer), max_concurrent)}
+        {
+        }
+
+        template<typename T>
+        void on_next(T&& v) const
+        {
+            base::m_disposable->increment_on_completed();
+            base::m_disposable->push(std::forward<T>(v));
+            merge_limited_disposable<TObservable, TObserver>::drain(base::m_disposable);
+        }
+
+    private:
+        static std::shared_ptr<merge_limited_disposable<TObservable, TObserver>> init_state(TObserver&& observer, size_t max_concurrent)
+        {
+            const auto d   = disposable_wrapper_impl<merge_limited_disposable<TObservable, TObserver>>::make(std::move(observer), max_concurrent);
+            auto       ptr = d.lock();
+            ptr->set_upstream(d.as_weak());
             return ptr;
         }
     };
@@ -155,6 +321,27 @@ namespace rpp::operators::details
         using updated_optimal_disposables_strategy = rpp::details::observables::fixed_disposables_strategy<1>;
     };
 
+    struct merge_limited_t : lift_operator<merge_limited_t, size_t>
+    {
+        using lift_operator<merge_limited_t, size_t>::lift_operator;
+
+        template<rpp::constraint::decayed_type T>
+        struct operator_traits
+        {
+            static_assert(rpp::constraint::observable<T>, "T is not observable");
+
+            using result_type = rpp::utils::extract_observable_type_t<T>;
+
+            constexpr static bool own_current_queue = true;
+
+            template<rpp::constraint::observer_of_type<result_type> TObserver>
+            using observer_strategy = merge_limited_observer_strategy<T, std::decay_t<TObserver>>;
+        };
+
+        template<rpp::details::observables::constraint::disposables_strategy Prev>
+        using updated_optimal_disposables_strategy = rpp::details::observables::fixed_disposables_strategy<1>;
+    };
+
     template<rpp::constraint::observable... TObservables>
     struct merge_with_t
     {
@@ -198,7 +385,7 @@ namespace rpp::operators
     /**
      * @brief Converts observable of observables of items into observable of items via merging emissions.
      *
-     * @invariant According to observable contract (https://reactivex.io/documentation/contract.html) emissions from any observable should be serialized, so, resulting observable uses mutex to satisfy this requirement
+     * @invariant According to observable contract (https://reactivex.io/documentation/contract.html) emissions from any observable should be serialized, so, resulting observable serializes them: thread which finds operator idle emits its own and queued emissions, other threads just enqueue their emissions
      *
      * @attention During on subscribe operator takes ownership over rpp::schedulers::current_thread to allow mixing of underlying emissions
      *
@@ -216,7 +403,7 @@ namespace rpp::operators
      *
      * @par Performance notes:
      * - 2 heap allocation (1 for state, 1 to convert observer to dynamic_observer)
-     * - Acquiring mutex during all observer's calls
+     * - Emissions are serialized via lock-free queue, so producers never block each other, but value obtained while another thread is emitting is copied/moved into queue
      *
      * @note `#include <rpp/operators/merge.hpp>`
      *
@@ -231,10 +418,40 @@ namespace rpp::operators
         return details::merge_t{};
     }
 
+    /**
+     * @brief Same as rpp::operators::merge, but subscribes to no more than `max_concurrent` inner observables at the same time. Other inner observables are queued and subscribed one by one as soon as any active one completes.
+     *
+     * @marble merge_max_concurrent
+         {
+             source observable                :
+             {
+                 +--1-2-3-|
+                 .....+4--6-|
+             }
+             operator "merge(1)" : +--1-2-3-4--6-|
+         }
+     *
+     * @details Use it to bound memory and scheduler load when source emits a lot of observables (for example, `flat_map` over huge source): queued observables are kept as is and don't hold any subscription or disposable.
+     *
+     * @par Performance notes:
+     * - Same as rpp::operators::merge
+     * - Acquiring extra mutex to queue/dequeue each inner observable
+     *
+     * @param max_concurrent maximum amount of inner observables subscribed at the same time. Values less than 1 are treated as 1.
+     * @note `#include <rpp/operators/merge.hpp>`
+     *
+     * @ingroup combining_operators
+     * @see https://reactivex.io/documentation/operators/merge.html
+     */
+    inline auto merge(size_t max_concurrent)
+    {
+        return details::merge_limited_t{max_concurrent};
+    }
+
     /**
      * @brief Combines submissions from current observable with other observables into one
      *
-     * @warning According to observable contract (https://reactivex.io/documentation/contract.html) emissions from any observable should be serialized, so, resulting observable uses mutex to satisfy this requirement
+     * @warning According to observable contract (https://reactivex.io/documentation/contract.html) emissions from any observable should be serialized, so, resulting observable serializes them: thread which finds operator idle emits its own and queued emissions, other threads just enqueue their emissions
      *
      * @warning During on subscribe operator takes ownership over rpp::schedulers::current_thread to allow mixing of underlying emissions
      *
@@ -249,7 +466,7 @@ namespace rpp::operators
      *
      * @par Performance notes:
      * - 2 heap allocation (1 for state, 1 to convert observer to dynamic_observer)
-     * - Acquiring mutex during all observer's calls
+     * - Emissions are serialized via lock-free queue, so producers never block each other, but value obtained while another thread is emitting is copied/moved into queue
      *
      * @param observables are observables whose emissions would be merged with current observable
      * @note `#include <rpp/operators/merge.hpp>`
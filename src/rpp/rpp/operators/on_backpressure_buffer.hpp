@@ -0,0 +1,346 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/operators/fwd.hpp>
+
+#include <rpp/defs.hpp>
+#include <rpp/disposables/composite_disposable.hpp>
+#include <rpp/operators/details/strategy.hpp>
+#include <rpp/utils/exceptions.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <variant>
+
+namespace rpp::operators::details
+{
+    template<rpp::constraint::observer Observer, typename Worker, rpp::details::disposables::constraint::disposables_container Container, typename OnDropFn>
+    struct backpressure_buffer_disposable final : public rpp::composite_disposable_impl<Container>
+    {
+        using T = rpp::utils::extract_observer_type_t<Observer>;
+
+        backpressure_buffer_disposable(Observer&& in_observer, Worker&& in_worker, size_t capacity, backpressure_overflow overflow, const OnDropFn& on_drop)
+            : observer(std::move(in_observer))
+            , worker{std::move(in_worker)}
+            , on_drop{on_drop}
+            , capacity{std::max(capacity, size_t{1})}
+            , overflow{overflow}
+        {
+        }
+
+        RPP_NO_UNIQUE_ADDRESS Observer observer;
+        RPP_NO_UNIQUE_ADDRESS Worker   worker;
+        RPP_NO_UNIQUE_ADDRESS OnDropFn on_drop;
+        const size_t                   capacity;
+        const backpressure_overflow    overflow;
+
+        std::mutex                                                        mutex{};
+        std::condition_variable                                           has_space{};
+        std::deque<std::variant<T, std::exception_ptr, rpp::utils::none>> queue{};
+        size_t                                                            dropped_count{};
+        bool                                                              is_active{};
+        bool                                                              is_terminated{};
+
+    private:
+        void composite_dispose_impl(interface_disposable::Mode) noexcept override
+        {
+            // wake up producer blocked by `backpressure_overflow::Block` to let it observe disposed state
+            {
+                std::lock_guard lock{mutex};
+            }
+            has_space.notify_all();
+        }
+    };
+
+    template<rpp::constraint::observer Observer, typename Worker, rpp::details::disposables::constraint::disposables_container Container, typename OnDropFn>
+    struct backpressure_buffer_disposable_wrapper
+    {
+        std::shared_ptr<backpressure_buffer_disposable<Observer, Worker, Container, OnDropFn>> disposable{};
+
+        bool is_disposed() const { return disposable->is_disposed(); }
+
+        void on_error(const std::exception_ptr& err) const { disposable->observer.on_error(err); }
+    };
+
+    template<rpp::constraint::observer Observer, typename Worker, rpp::details::disposables::constraint::disposables_container Container, typename OnDropFn>
+    struct backpressure_buffer_observer_strategy
+    {
+        using disposable_t = backpressure_buffer_disposable<Observer, Worker, Container, OnDropFn>;
+        using wrapper_t    = backpressure_buffer_disposable_wrapper<Observer, Worker, Container, OnDropFn>;
+
+        static constexpr auto         preferred_disposables_mode = rpp::details::observers::disposables_mode::Boolean;
+        std::shared_ptr<disposable_t> disposable{};
+
+        void set_upstream(const rpp::disposable_wrapper& d) const
+        {
+            disposable->add(d);
+        }
+
+        bool is_disposed() const
+        {
+            return disposable->is_disposed();
+        }
+
+        template<typename T>
+        void on_next(T&& v) const
+        {
+            std::optional<size_t> dropped_count{};
+            bool                  need_to_schedule{};
+            bool                  overflowed{};
+            {
+                std::unique_lock lock{disposable->mutex};
+                if (disposable->is_terminated)
+                    return;
+
+                if (disposable->queue.size() >= disposable->capacity)
+                {
+                    switch (disposable->overflow)
+                    {
+                    case backpressure_overflow::DropNewest:
+                        dropped_count = ++disposable->dropped_count;
+                        break;
+                    case backpressure_overflow::DropOldest:
+                        disposable->queue.pop_front();
+                        disposable->queue.emplace_back(std::in_place_index<0>, std::forward<T>(v));
+                        dropped_count = ++disposable->dropped_count;
+                        break;
+                    case backpressure_overflow::Error:
+                        need_to_schedule = terminate_with(std::make_exception_ptr(rpp::utils::buffer_overflow{"on_backpressure_buffer: capacity exceeded"}));
+                        overflowed       = true;
+                        break;
+                    case backpressure_overflow::Block:
+                        disposable->has_space.wait(lock, [&] { return disposable->queue.size() < disposable->capacity || disposable->is_terminated || disposable->is_disposed(); });
+                        if (disposable->is_disposed() || disposable->is_terminated)
+                            return;
+                        need_to_schedule = emplace(std::in_place_index<0>, std::forward<T>(v));
+                        break;
+                    }
+                }
+                else
+                {
+                    need_to_schedule = emplace(std::in_place_index<0>, std::forward<T>(v));
+                }
+            }
+
+            if (overflowed)
+                disposable->clear();
+            if (dropped_count)
+                disposable->on_drop(dropped_count.value());
+            if (need_to_schedule)
+                schedule_drain();
+        }
+
+        void on_error(const std::exception_ptr& err) const noexcept
+        {
+            bool need_to_schedule{};
+            {
+                std::lock_guard lock{disposable->mutex};
+                if (disposable->is_terminated)
+                    return;
+                need_to_schedule = terminate_with(err);
+            }
+            disposable->clear();
+            if (need_to_schedule)
+                schedule_drain();
+        }
+
+        void on_completed() const noexcept
+        {
+            bool need_to_schedule{};
+            {
+                std::lock_guard lock{disposable->mutex};
+                if (disposable->is_terminated)
+                    return;
+                disposable->is_terminated = true;
+                need_to_schedule          = emplace(std::in_place_index<2>, rpp::utils::none{});
+            }
+            disposable->clear();
+            if (need_to_schedule)
+                schedule_drain();
+        }
+
+    private:
+        template<size_t I, typename TT>
+        bool emplace(std::in_place_index_t<I> index, TT&& value) const
+        {
+            disposable->queue.emplace_back(index, std::forward<TT>(value));
+            return !std::exchange(disposable->is_active, true);
+        }
+
+        // error is not a subject for backpressure: pending values are discarded and error is delivered as soon as possible
+        bool terminate_with(const std::exception_ptr& err) const
+        {
+            disposable->is_terminated = true;
+            disposable->queue.clear();
+            disposable->has_space.notify_all();
+            return emplace(std::in_place_index<1>, err);
+        }
+
+        void schedule_drain() const
+        {
+            disposable->worker.schedule([](const wrapper_t& wrapper) { return drain_queue(wrapper.disposable); },
+                                        wrapper_t{disposable});
+        }
+
+        static schedulers::optional_delay_from_now drain_queue(const std::shared_ptr<disposable_t>& disposable)
+        {
+            while (true)
+            {
+                std::unique_lock lock{disposable->mutex};
+                if (disposable->queue.empty() || disposable->is_disposed())
+                {
+                    disposable->is_active = false;
+                    return std::nullopt;
+                }
+
+                auto item = std::move(disposable->queue.front());
+                disposable->queue.pop_front();
+                lock.unlock();
+                disposable->has_space.notify_one();
+
+                std::visit(rpp::utils::overloaded{[&](rpp::utils::extract_observer_type_t<Observer>&& v) { disposable->observer.on_next(std::move(v)); },
+                                                  [&](const std::exception_ptr& err) { disposable->observer.on_error(err); },
+                                                  [&](rpp::utils::none) {
+                                                      disposable->observer.on_completed();
+                                                  }},
+                           std::move(item));
+            }
+        }
+    };
+
+    template<rpp::schedulers::constraint::scheduler Scheduler, typename OnDropFn>
+    struct on_backpressure_buffer_t
+    {
+        template<rpp::constraint::decayed_type T>
+        struct operator_traits
+        {
+            using result_type = T;
+        };
+
+        template<rpp::details::observables::constraint::disposables_strategy Prev>
+        using updated_optimal_disposables_strategy = rpp::details::observables::fixed_disposables_strategy<1>;
+
+        size_t                          capacity;
+        backpressure_overflow           overflow;
+        RPP_NO_UNIQUE_ADDRESS Scheduler scheduler;
+        RPP_NO_UNIQUE_ADDRESS OnDropFn  on_drop;
+
+        template<rpp::constraint::decayed_type Type, rpp::details::observables::constraint::disposables_strategy DisposableStrategy, rpp::constraint::observer Observer>
+        auto lift_with_disposables_strategy(Observer&& observer) const
+        {
+            using worker_t  = rpp::schedulers::utils::get_worker_t<Scheduler>;
+            using container = typename DisposableStrategy::disposables_container;
+            using strategy  = backpressure_buffer_observer_strategy<std::decay_t<Observer>, worker_t, container, OnDropFn>;
+
+            const auto disposable = disposable_wrapper_impl<typename strategy::disposable_t>::make(std::forward<Observer>(observer), scheduler.create_worker(), capacity, overflow, on_drop);
+            auto       ptr        = disposable.lock();
+            ptr->observer.set_upstream(disposable.as_weak());
+            return rpp::observer<Type, strategy>{std::move(ptr)};
+        }
+    };
+} // namespace rpp::operators::details
+
+namespace rpp::operators
+{
+    /**
+     * @brief Places bounded queue between the source observable and the observer: emissions are delivered to the observer via provided scheduler, while at most `capacity` of them may wait for the observer.
+     *
+     * @marble on_backpressure_buffer
+        {
+            source observable                                  : +-1-2-3-4-|
+            operator "on_backpressure_buffer(2, DropNewest)"   : +---1---2---3-|
+        }
+     *
+     * @details Actually this operator is `observe_on` with bounded queue. When the queue is full and new value arrives from the source, operator applies provided `overflow` policy:
+     * - `backpressure_overflow::DropNewest` - new value is dropped
+     * - `backpressure_overflow::DropOldest` - the oldest queued value is dropped and new value is queued
+     * - `backpressure_overflow::Error` - queue is cleared, source is disposed and `rpp::utils::buffer_overflow` is emitted
+     * - `backpressure_overflow::Block` - producer's thread is blocked till observer takes value from the queue
+     *
+     * @details `on_drop` is invoked from producer's thread with total amount of dropped values after each drop.
+     * @details `on_error` from source is not a subject for backpressure: pending values are cleared and error is forwarded as soon as possible. `on_completed` is forwarded after all queued values.
+     *
+     * @par Performance notes:
+     * - Memory usage is limited by `capacity` values regardless of the load
+     * - Each emission takes one lock of internal mutex, scheduler is invoked only when the queue was empty
+     *
+     * @warning `backpressure_overflow::Block` policy requires scheduler draining queue in another thread (e.g., `new_thread` or `thread_pool`), otherwise it is deadlock.
+     *
+     * @param capacity is maximum amount of values waiting for the observer. Capacity 0 is treated as 1.
+     * @param scheduler provides the threading model for emissions to the observer.
+     * @param overflow is policy applied when the queue is full.
+     * @param on_drop is callback invoked with total amount of dropped values for `DropNewest` and `DropOldest` policies.
+     * @note `#include <rpp/operators/on_backpressure_buffer.hpp>`
+     *
+     * @ingroup utility_operators
+     * @see https://reactivex.io/documentation/operators/backpressure.html
+     */
+    template<rpp::schedulers::constraint::scheduler Scheduler, std::invocable<size_t> OnDropFn>
+    auto on_backpressure_buffer(size_t capacity, Scheduler&& scheduler, backpressure_overflow overflow, OnDropFn&& on_drop)
+    {
+        return details::on_backpressure_buffer_t<std::decay_t<Scheduler>, std::decay_t<OnDropFn>>{capacity, overflow, std::forward<Scheduler>(scheduler), std::forward<OnDropFn>(on_drop)};
+    }
+
+    /**
+     * @brief Delivers emissions to the observer via provided scheduler, while at most one value may wait for the observer. New values arriving while one value is already waiting are dropped.
+     *
+     * @marble on_backpressure_drop
+        {
+            source observable               : +-1-2-3-4-|
+            operator "on_backpressure_drop" : +---1---2---|
+        }
+     *
+     * @details Actually this operator is `on_backpressure_buffer(1, scheduler, backpressure_overflow::DropNewest, on_drop)`
+     *
+     * @param scheduler provides the threading model for emissions to the observer.
+     * @param on_drop is callback invoked with total amount of dropped values.
+     * @note `#include <rpp/operators/on_backpressure_buffer.hpp>`
+     *
+     * @ingroup utility_operators
+     * @see https://reactivex.io/documentation/operators/backpressure.html
+     */
+    template<rpp::schedulers::constraint::scheduler Scheduler, std::invocable<size_t> OnDropFn>
+    auto on_backpressure_drop(Scheduler&& scheduler, OnDropFn&& on_drop)
+    {
+        return on_backpressure_buffer(1, std::forward<Scheduler>(scheduler), backpressure_overflow::DropNewest, std::forward<OnDropFn>(on_drop));
+    }
+
+    /**
+     * @brief Delivers emissions to the observer via provided scheduler, while only the latest value may wait for the observer. New value replaces value which is already waiting.
+     *
+     * @marble on_backpressure_latest
+        {
+            source observable                 : +-1-2-3-4-|
+            operator "on_backpressure_latest" : +---1---4-|
+        }
+     *
+     * @details Actually this operator is `on_backpressure_buffer(1, scheduler, backpressure_overflow::DropOldest, on_drop)`
+     *
+     * @param scheduler provides the threading model for emissions to the observer.
+     * @param on_drop is callback invoked with total amount of dropped values.
+     * @note `#include <rpp/operators/on_backpressure_buffer.hpp>`
+     *
+     * @ingroup utility_operators
+     * @see https://reactivex.io/documentation/operators/backpressure.html
+     */
+    template<rpp::schedulers::constraint::scheduler Scheduler, std::invocable<size_t> OnDropFn>
+    auto on_backpressure_latest(Scheduler&& scheduler, OnDropFn&& on_drop)
+    {
+        return on_backpressure_buffer(1, std::forward<Scheduler>(scheduler), backpressure_overflow::DropOldest, std::forward<OnDropFn>(on_drop));
+    }
+} // namespace rpp::operators
@@ -0,0 +1,328 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/operators/fwd.hpp>
+
+#include <rpp/defs.hpp>
+#include <rpp/disposables/composite_disposable.hpp>
+#include <rpp/operators/details/strategy.hpp>
+#include <rpp/utils/ring_buffer.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace rpp::operators::details
+{
+    template<rpp::constraint::observer Observer, typename Worker, typename Fn, rpp::details::disposables::constraint::disposables_container Container, bool Ordered>
+    class parallel_map_disposable;
+
+    template<rpp::constraint::observer Observer, typename Worker, typename Fn, rpp::details::disposables::constraint::disposables_container Container, bool Ordered>
+    struct parallel_map_disposable_wrapper
+    {
+        std::shared_ptr<parallel_map_disposable<Observer, Worker, Fn, Container, Ordered>> disposable{};
+
+        bool is_disposed() const { return disposable->is_disposed(); }
+
+        void on_error(const std::exception_ptr& err) const { disposable->on_error(err); }
+    };
+
+    /**
+     * @brief State of parallel_map: items are dispatched to workers round-robin, results are collected and emitted by thread which obtained next result while no other thread is emitting.
+     *
+     * @details In ordered mode each result is placed to slot of its sequence number, so only contiguous prefix of results is emitted. Amount of items dispatched but not emitted yet is limited by `max_in_flight`: producer is blocked till some result is emitted.
+     */
+    template<rpp::constraint::observer Observer, typename Worker, typename Fn, rpp::details::disposables::constraint::disposables_container Container, bool Ordered>
+    class parallel_map_disposable final : public rpp::composite_disposable_impl<Container>
+        , public rpp::details::enable_wrapper_from_this<parallel_map_disposable<Observer, Worker, Fn, Container, Ordered>>
+    {
+        using Result  = rpp::utils::extract_observer_type_t<Observer>;
+        using Wrapper = parallel_map_disposable_wrapper<Observer, Worker, Fn, Container, Ordered>;
+
+    public:
+        parallel_map_disposable(Observer&& observer, std::vector<Worker>&& workers, const Fn& fn, size_t max_in_flight)
+            : m_observer{std::move(observer)}
+            , m_workers{std::move(workers)}
+            , m_fn{fn}
+            , m_max_in_flight{max_in_flight}
+            , m_slots(Ordered ? max_in_flight : 0)
+        {
+        }
+
+        // called only once during creation of state before any emission
+        void set_upstream(const disposable_wrapper& d) { m_observer.set_upstream(d); }
+
+        template<typename T>
+        void on_next(T&& v)
+        {
+            size_t index{};
+            {
+                std::unique_lock lock{m_mutex};
+                m_has_slot.wait(lock, [&] { return m_in_flight < m_max_in_flight || this->is_disposed(); });
+                if (this->is_disposed())
+                    return;
+
+                ++m_in_flight;
+                index = m_dispatched++;
+            }
+
+            m_workers[index % m_workers.size()].schedule(
+                [](const Wrapper& wrapper, size_t idx, std::decay_t<T>& value) -> schedulers::optional_delay_from_now {
+                    wrapper.disposable->on_result(idx, wrapper.disposable->m_fn(std::move(value)));
+                    return std::nullopt;
+                },
+                Wrapper{this->wrapper_from_this().lock()},
+                index,
+                std::decay_t<T>{std::forward<T>(v)});
+        }
+
+        void on_error(const std::exception_ptr& err)
+        {
+            std::unique_lock lock{m_mutex};
+            if (!m_error)
+                m_error.emplace(err);
+            try_drain(lock);
+        }
+
+        void on_completed()
+        {
+            std::unique_lock lock{m_mutex};
+            m_completed = true;
+            try_drain(lock);
+        }
+
+    private:
+        void on_result(size_t index, Result&& result)
+        {
+            std::unique_lock lock{m_mutex};
+            if constexpr (Ordered)
+                m_slots[index % m_max_in_flight].emplace(std::move(result));
+            else
+                m_pending.emplace_back(std::move(result));
+
+            try_drain(lock);
+        }
+
+        void try_drain(std::unique_lock<std::mutex>& lock)
+        {
+            if (std::exchange(m_draining, true))
+                return;
+
+            while (true)
+            {
+                if (m_error)
+                {
+                    lock.unlock();
+                    m_observer.on_error(m_error.value());
+                    return;
+                }
+
+                collect_ready();
+                if (m_ready.empty())
+                {
+                    if (m_completed && m_in_flight == 0)
+                    {
+                        lock.unlock();
+                        m_observer.on_completed();
+                        return;
+                    }
+
+                    m_draining = false;
+                    return;
+                }
+
+                lock.unlock();
+                const auto count = m_ready.size();
+                for (; !m_ready.empty(); m_ready.pop_front())
+                    m_observer.on_next(std::move(m_ready.front()));
+
+                lock.lock();
+                m_in_flight -= count;
+                m_has_slot.notify_all();
+            }
+        }
+
+        void collect_ready()
+        {
+            if constexpr (Ordered)
+            {
+                for (auto* slot = &m_slots[m_emitted % m_max_in_flight]; slot->has_value(); slot = &m_slots[m_emitted % m_max_in_flight])
+                {
+                    m_ready.emplace_back(std::move(slot->value()));
+                    slot->reset();
+                    ++m_emitted;
+                }
+            }
+            else
+            {
+                std::swap(m_pending, m_ready);
+            }
+        }
+
+        void composite_dispose_impl(interface_disposable::Mode) noexcept override
+        {
+            // wake up producer blocked by `max_in_flight` to let it observe disposed state
+            {
+                std::lock_guard lock{m_mutex};
+            }
+            m_has_slot.notify_all();
+        }
+
+    private:
+        RPP_NO_UNIQUE_ADDRESS Observer m_observer;
+        std::vector<Worker>            m_workers;
+        RPP_NO_UNIQUE_ADDRESS const Fn m_fn;
+        const size_t                   m_max_in_flight;
+
+        std::mutex                        m_mutex{};
+        std::condition_variable           m_has_slot{};
+        size_t                            m_in_flight{};
+        size_t                            m_dispatched{};
+        size_t                            m_emitted{};
+        bool                              m_draining{};
+        bool                              m_completed{};
+        std::optional<std::exception_ptr> m_error{};
+
+        // results by sequence number for ordered mode, results in order of obtaining otherwise
+        std::vector<std::optional<Result>> m_slots;
+        rpp::utils::ring_buffer<Result>    m_pending{};
+        // results moved out by draining thread, accessed only by it
+        rpp::utils::ring_buffer<Result> m_ready{};
+    };
+
+    template<rpp::constraint::observer Observer, typename Worker, typename Fn, rpp::details::disposables::constraint::disposables_container Container, bool Ordered>
+    struct parallel_map_observer_strategy
+    {
+        static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::None;
+
+        std::shared_ptr<parallel_map_disposable<Observer, Worker, Fn, Container, Ordered>> disposable{};
+
+        void set_upstream(const rpp::disposable_wrapper& d) const { disposable->add(d); }
+
+        bool is_disposed() const { return disposable->is_disposed(); }
+
+        template<typename T>
+        void on_next(T&& v) const
+        {
+            disposable->on_next(std::forward<T>(v));
+        }
+
+        void on_error(const std::exception_ptr& err) const { disposable->on_error(err); }
+
+        void on_completed() const { disposable->on_completed(); }
+    };
+
+    template<rpp::constraint::decayed_type Fn, rpp::schedulers::constraint::scheduler Scheduler, bool Ordered>
+    struct parallel_map_t
+    {
+        template<rpp::constraint::decayed_type T>
+        struct operator_traits
+        {
+            static_assert(std::invocable<const Fn&, T>, "Fn is not invocable with T");
+
+            using result_type = std::decay_t<std::invoke_result_t<const Fn&, T>>;
+        };
+
+        template<rpp::details::observables::constraint::disposables_strategy Prev>
+        using updated_optimal_disposables_strategy = rpp::details::observables::fixed_disposables_strategy<1>;
+
+        RPP_NO_UNIQUE_ADDRESS Fn        fn;
+        RPP_NO_UNIQUE_ADDRESS Scheduler scheduler;
+        size_t                          max_in_flight;
+
+        template<rpp::constraint::decayed_type Type, rpp::details::observables::constraint::disposables_strategy DisposableStrategy, rpp::constraint::observer Observer>
+        auto lift_with_disposables_strategy(Observer&& observer) const
+        {
+            using worker_t   = rpp::schedulers::utils::get_worker_t<Scheduler>;
+            using container  = typename DisposableStrategy::disposables_container;
+            using disposable = parallel_map_disposable<std::decay_t<Observer>, worker_t, Fn, container, Ordered>;
+
+            const auto in_flight = std::max(max_in_flight, size_t{1});
+
+            // there is no sense to have more workers than items in flight or than cores
+            std::vector<worker_t> workers{};
+            const auto            workers_count = std::min(in_flight, size_t{std::max(std::thread::hardware_concurrency(), 1u)});
+            workers.reserve(workers_count);
+            for (size_t i = 0; i < workers_count; ++i)
+                workers.push_back(scheduler.create_worker());
+
+            const auto d   = disposable_wrapper_impl<disposable>::make(std::forward<Observer>(observer), std::move(workers), fn, in_flight);
+            auto       ptr = d.lock();
+            ptr->set_upstream(d.as_weak());
+            return rpp::observer<Type, parallel_map_observer_strategy<std::decay_t<Observer>, worker_t, Fn, container, Ordered>>{std::move(ptr)};
+        }
+    };
+} // namespace rpp::operators::details
+
+namespace rpp::operators
+{
+    /**
+     * @brief Transform items via applying function to each of them on multiple workers of scheduler in parallel, while emitting results in original order.
+     *
+     * @marble parallel_map
+         {
+             source observable                  : +-1-2-3-|
+             operator "parallel_map: x=>x*10"   : +---10-20-30-|
+         }
+     *
+     * @details Items are dispatched round-robin to workers obtained from scheduler on subscription (not more than `max_in_flight` and than amount of cores). Each result is kept till all results of preceding items are ready, then contiguous results are emitted at once by thread which obtained the last of them.
+     * @details At most `max_in_flight` items can be dispatched but not emitted yet: upstream's `on_next` blocks till some result is emitted. As a result, source should not emit from the same thread that processes items (for example, from a worker of the same single-threaded scheduler).
+     * @details `on_completed` is emitted after all results. Any error (from upstream or thrown by `fn`) is forwarded immediately and pending results are dropped.
+     * @warning `fn` is invoked concurrently from multiple threads.
+     *
+     * @par Performance notes:
+     * - 1 heap allocation for state + 1 schedulable per item
+     * - mutex acquired to dispatch item and to store its result, results are emitted outside of mutex in batches
+     *
+     * @param fn is function to apply to each item. Should be thread-safe.
+     * @param scheduler provides workers to apply `fn`, e.g. rpp::schedulers::thread_pool
+     * @param max_in_flight is maximum amount of items which are processed or waiting for preceding results at the same time
+     *
+     * @note `#include <rpp/operators/parallel_map.hpp>`
+     *
+     * @ingroup transforming_operators
+     * @see https://reactivex.io/documentation/operators/map.html
+     */
+    template<typename Fn, rpp::schedulers::constraint::scheduler Scheduler>
+    auto parallel_map(Fn&& fn, Scheduler&& scheduler, size_t max_in_flight)
+    {
+        return details::parallel_map_t<std::decay_t<Fn>, std::decay_t<Scheduler>, true>{std::forward<Fn>(fn), std::forward<Scheduler>(scheduler), max_in_flight};
+    }
+
+    /**
+     * @brief Same as rpp::operators::parallel_map, but results are emitted in order of their obtaining, so slow item doesn't delay results of following ones.
+     *
+     * @marble parallel_map_unordered
+         {
+             source observable                            : +-1-2-3-|
+             operator "parallel_map_unordered: x=>x*10"   : +---20-10-30-|
+         }
+     *
+     * @param fn is function to apply to each item. Should be thread-safe.
+     * @param scheduler provides workers to apply `fn`, e.g. rpp::schedulers::thread_pool
+     * @param max_in_flight is maximum amount of items which are processed or waiting for emission at the same time
+     *
+     * @note `#include <rpp/operators/parallel_map.hpp>`
+     *
+     * @ingroup transforming_operators
+     * @see https://reactivex.io/documentation/operators/map.html
+     */
+    template<typename Fn, rpp::schedulers::constraint::scheduler Scheduler>
+    auto parallel_map_unordered(Fn&& fn, Scheduler&& scheduler, size_t max_in_flight)
+    {
+        return details::parallel_map_t<std::decay_t<Fn>, std::decay_t<Scheduler>, false>{std::forward<Fn>(fn), std::forward<Scheduler>(scheduler), max_in_flight};
+    }
+} // namespace rpp::operators
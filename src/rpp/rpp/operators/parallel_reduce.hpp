@@ -0,0 +1,299 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/operators/fwd.hpp>
+
+#include <rpp/defs.hpp>
+#include <rpp/disposables/composite_disposable.hpp>
+#include <rpp/operators/details/strategy.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace rpp::operators::details
+{
+    template<rpp::constraint::decayed_type Type, rpp::constraint::observer Observer, typename Worker, typename Combine, typename Merge, rpp::details::disposables::constraint::disposables_container Container>
+    class parallel_reduce_disposable;
+
+    template<rpp::constraint::decayed_type Type, rpp::constraint::observer Observer, typename Worker, typename Combine, typename Merge, rpp::details::disposables::constraint::disposables_container Container>
+    struct parallel_reduce_disposable_wrapper
+    {
+        std::shared_ptr<parallel_reduce_disposable<Type, Observer, Worker, Combine, Merge, Container>> disposable{};
+
+        bool is_disposed() const { return disposable->is_disposed(); }
+
+        void on_error(const std::exception_ptr& err) const { disposable->on_error(err); }
+    };
+
+    /**
+     * @brief State of parallel_reduce: items are collected into chunks, each chunk is reduced from seed on one of workers. Partial results are merged in order of chunks as soon as all preceding partial results are merged.
+     */
+    template<rpp::constraint::decayed_type Type, rpp::constraint::observer Observer, typename Worker, typename Combine, typename Merge, rpp::details::disposables::constraint::disposables_container Container>
+    class parallel_reduce_disposable final : public rpp::composite_disposable_impl<Container>
+        , public rpp::details::enable_wrapper_from_this<parallel_reduce_disposable<Type, Observer, Worker, Combine, Merge, Container>>
+    {
+        using Seed    = rpp::utils::extract_observer_type_t<Observer>;
+        using Wrapper = parallel_reduce_disposable_wrapper<Type, Observer, Worker, Combine, Merge, Container>;
+
+    public:
+        parallel_reduce_disposable(Observer&& observer, std::vector<Worker>&& workers, const Seed& seed, const Combine& combine, const Merge& merge, size_t chunk_size)
+            : m_observer{std::move(observer)}
+            , m_workers{std::move(workers)}
+            , m_seed{seed}
+            , m_combine{combine}
+            , m_merge{merge}
+            , m_chunk_size{chunk_size}
+            // chunks are prepared by producer while workers are busy with previous ones
+            , m_max_in_flight{m_workers.size() * 2}
+        {
+            m_chunk.reserve(m_chunk_size);
+        }
+
+        // called only once during creation of state before any emission
+        void set_upstream(const disposable_wrapper& d) { m_observer.set_upstream(d); }
+
+        template<typename T>
+        void on_next(T&& v)
+        {
+            m_chunk.push_back(std::forward<T>(v));
+            if (m_chunk.size() == m_chunk_size)
+                dispatch_chunk();
+        }
+
+        void on_error(const std::exception_ptr& err)
+        {
+            {
+                std::lock_guard lock{m_mutex};
+                if (std::exchange(m_done, true))
+                    return;
+            }
+            // cancel chunks which are not reduced yet and release upstream
+            this->dispose();
+            m_observer.on_error(err);
+        }
+
+        void on_completed()
+        {
+            if (!m_chunk.empty())
+                dispatch_chunk();
+
+            std::unique_lock lock{m_mutex};
+            m_completed = true;
+            finish_if_needed(lock);
+        }
+
+    private:
+        void dispatch_chunk()
+        {
+            size_t index{};
+            {
+                std::unique_lock lock{m_mutex};
+                m_has_slot.wait(lock, [&] { return m_in_flight < m_max_in_flight || this->is_disposed(); });
+                if (this->is_disposed())
+                    return;
+
+                ++m_in_flight;
+                index = m_dispatched++;
+            }
+
+            auto chunk = std::move(m_chunk);
+            m_chunk    = std::vector<Type>{};
+            m_chunk.reserve(m_chunk_size);
+
+            m_workers[index % m_workers.size()].schedule(
+                [](const Wrapper& wrapper, size_t idx, std::vector<Type>& items) -> schedulers::optional_delay_from_now {
+                    const auto& d = wrapper.disposable;
+
+                    Seed partial = d->m_seed;
+                    for (auto& item : items)
+                        partial = d->m_combine(std::move(partial), std::move(item));
+
+                    d->on_partial(idx, std::move(partial));
+                    return std::nullopt;
+                },
+                Wrapper{this->wrapper_from_this().lock()},
+                index,
+                std::move(chunk));
+        }
+
+        void on_partial(size_t index, Seed&& partial)
+        {
+            std::unique_lock lock{m_mutex};
+            m_partials.emplace(index, std::move(partial));
+            for (auto it = m_partials.begin(); it != m_partials.end() && it->first == m_merged_count; it = m_partials.erase(it), ++m_merged_count)
+            {
+                if (m_result)
+                    m_result.emplace(m_merge(std::move(m_result).value(), std::move(it->second)));
+                else
+                    m_result.emplace(std::move(it->second));
+            }
+
+            --m_in_flight;
+            m_has_slot.notify_all();
+            finish_if_needed(lock);
+        }
+
+        void finish_if_needed(std::unique_lock<std::mutex>& lock)
+        {
+            if (!m_completed || m_in_flight != 0 || std::exchange(m_done, true))
+                return;
+
+            auto result = m_result ? std::move(m_result).value() : m_seed;
+            lock.unlock();
+
+            m_observer.on_next(std::move(result));
+            m_observer.on_completed();
+        }
+
+        void composite_dispose_impl(interface_disposable::Mode) noexcept override
+        {
+            // wake up producer blocked by amount of chunks in flight to let it observe disposed state
+            {
+                std::lock_guard lock{m_mutex};
+            }
+            m_has_slot.notify_all();
+        }
+
+    private:
+        RPP_NO_UNIQUE_ADDRESS Observer      m_observer;
+        std::vector<Worker>                 m_workers;
+        const Seed                          m_seed;
+        RPP_NO_UNIQUE_ADDRESS const Combine m_combine;
+        RPP_NO_UNIQUE_ADDRESS const Merge   m_merge;
+        const size_t                        m_chunk_size;
+        const size_t                        m_max_in_flight;
+
+        // accessed only by producer
+        std::vector<Type> m_chunk{};
+
+        std::mutex              m_mutex{};
+        std::condition_variable m_has_slot{};
+        size_t                  m_in_flight{};
+        size_t                  m_dispatched{};
+        size_t                  m_merged_count{};
+        bool                    m_completed{};
+        bool                    m_done{};
+        std::map<size_t, Seed>  m_partials{};
+        std::optional<Seed>     m_result{};
+    };
+
+    template<rpp::constraint::decayed_type Type, rpp::constraint::observer Observer, typename Worker, typename Combine, typename Merge, rpp::details::disposables::constraint::disposables_container Container>
+    struct parallel_reduce_observer_strategy
+    {
+        static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::None;
+
+        std::shared_ptr<parallel_reduce_disposable<Type, Observer, Worker, Combine, Merge, Container>> disposable{};
+
+        void set_upstream(const rpp::disposable_wrapper& d) const { disposable->add(d); }
+
+        bool is_disposed() const { return disposable->is_disposed(); }
+
+        template<typename T>
+        void on_next(T&& v) const
+        {
+            disposable->on_next(std::forward<T>(v));
+        }
+
+        void on_error(const std::exception_ptr& err) const { disposable->on_error(err); }
+
+        void on_completed() const { disposable->on_completed(); }
+    };
+
+    template<rpp::constraint::decayed_type Seed, rpp::constraint::decayed_type Combine, rpp::constraint::decayed_type Merge, rpp::schedulers::constraint::scheduler Scheduler>
+    struct parallel_reduce_t
+    {
+        template<rpp::constraint::decayed_type T>
+        struct operator_traits
+        {
+            static_assert(std::is_invocable_r_v<Seed, const Combine&, Seed&&, T&&>, "Combine is not invocable with Seed&& and T returning Seed");
+            static_assert(std::is_invocable_r_v<Seed, const Merge&, Seed&&, Seed&&>, "Merge is not invocable with Seed&& and Seed&& returning Seed");
+
+            using result_type = Seed;
+        };
+
+        template<rpp::details::observables::constraint::disposables_strategy Prev>
+        using updated_optimal_disposables_strategy = rpp::details::observables::fixed_disposables_strategy<1>;
+
+        Seed                            seed;
+        RPP_NO_UNIQUE_ADDRESS Combine   combine;
+        RPP_NO_UNIQUE_ADDRESS Merge     merge;
+        RPP_NO_UNIQUE_ADDRESS Scheduler scheduler;
+        size_t                          chunk_size;
+
+        template<rpp::constraint::decayed_type Type, rpp::details::observables::constraint::disposables_strategy DisposableStrategy, rpp::constraint::observer Observer>
+        auto lift_with_disposables_strategy(Observer&& observer) const
+        {
+            using worker_t   = rpp::schedulers::utils::get_worker_t<Scheduler>;
+            using container  = typename DisposableStrategy::disposables_container;
+            using disposable = parallel_reduce_disposable<Type, std::decay_t<Observer>, worker_t, Combine, Merge, container>;
+
+            std::vector<worker_t> workers{};
+            const size_t          workers_count = std::max(std::thread::hardware_concurrency(), 1u);
+            workers.reserve(workers_count);
+            for (size_t i = 0; i < workers_count; ++i)
+                workers.push_back(scheduler.create_worker());
+
+            const auto d   = disposable_wrapper_impl<disposable>::make(std::forward<Observer>(observer), std::move(workers), seed, combine, merge, std::max(chunk_size, size_t{1}));
+            auto       ptr = d.lock();
+            ptr->set_upstream(d.as_weak());
+            return rpp::observer<Type, parallel_reduce_observer_strategy<Type, std::decay_t<Observer>, worker_t, Combine, Merge, container>>{std::move(ptr)};
+        }
+    };
+} // namespace rpp::operators::details
+
+namespace rpp::operators
+{
+    /**
+     * @brief Reduce items of finite observable in parallel: items are split into chunks, each chunk is reduced on worker of scheduler, then partial results are merged into single value.
+     *
+     * @marble parallel_reduce
+     {
+         source observable                                      : +--1-2-3-4-|
+         operator "parallel_reduce: s=0, (s,x)=>s+x, chunk=2"   : +----------10|
+     }
+     *
+     * @details Actually this operator collects `chunk_size` items into chunk and dispatches it to one of workers (amount of workers equals to amount of cores), where chunk is reduced via `combine` starting from copy of `seed`. Partial results are merged via `merge` strictly in order of chunks, so `combine` and `merge` are required to be associative, but not commutative.
+     * @details `seed` is used as initial value of each chunk, so it should be identity value for `merge` (e.g. 0 for sum). In case of no any items `seed` is emitted.
+     * @details At most 2 chunks per worker are in flight: upstream's `on_next` blocks till some chunk is reduced. As a result, source should not emit from the same thread that reduces chunks.
+     * @warning `combine` and `merge` are invoked concurrently from multiple threads.
+     *
+     * @par Performance notes:
+     * - 1 heap allocation for state + 1 vector per chunk
+     * - mutex acquired once per chunk, not per item
+     *
+     * @param seed is initial value of each chunk and result in case of empty observable
+     * @param combine is function which accepts partial result and new item and returns new partial result
+     * @param merge is function which accepts two partial results (of earlier and later chunks) and returns merged result
+     * @param scheduler provides workers to reduce chunks, e.g. rpp::schedulers::thread_pool or rpp::schedulers::computational
+     * @param chunk_size is amount of items reduced by one worker at once
+     *
+     * @note `#include <rpp/operators/parallel_reduce.hpp>`
+     *
+     * @ingroup aggregate_operators
+     * @see https://reactivex.io/documentation/operators/reduce.html
+     */
+    template<typename Seed, typename Combine, typename Merge, rpp::schedulers::constraint::scheduler Scheduler>
+    auto parallel_reduce(Seed&& seed, Combine&& combine, Merge&& merge, Scheduler&& scheduler, size_t chunk_size)
+    {
+        return details::parallel_reduce_t<std::decay_t<Seed>, std::decay_t<Combine>, std::decay_t<Merge>, std::decay_t<Scheduler>>{std::forward<Seed>(seed),
+                                                                                                                                   std::forward<Combine>(combine),
+                                                                                                                                   std::forward<Merge>(merge),
+                                                                                                                                   std::forward<Scheduler>(scheduler),
+                                                                                                                                   chunk_size};
+    }
+} // namespace rpp::operators
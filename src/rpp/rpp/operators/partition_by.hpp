@@ -0,0 +1,322 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/operators/fwd.hpp>
+
+#include <rpp/defs.hpp>
+#include <rpp/disposables/composite_disposable.hpp>
+#include <rpp/operators/details/strategy.hpp>
+#include <rpp/utils/functors.hpp>
+#include <rpp/utils/ring_buffer.hpp>
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+
+namespace rpp::operators::details
+{
+    template<rpp::constraint::decayed_type Type, rpp::constraint::observer Observer, typename Worker, typename KeyFn, typename Fn, rpp::details::disposables::constraint::disposables_container Container>
+    class partition_by_disposable;
+
+    template<rpp::constraint::decayed_type Type, rpp::constraint::observer Observer, typename Worker, typename KeyFn, typename Fn, rpp::details::disposables::constraint::disposables_container Container>
+    struct partition_by_disposable_wrapper
+    {
+        std::shared_ptr<partition_by_disposable<Type, Observer, Worker, KeyFn, Fn, Container>> disposable{};
+
+        bool is_disposed() const { return disposable->is_disposed(); }
+
+        void on_error(const std::exception_ptr& err) const { disposable->on_error(err); }
+    };
+
+    /**
+     * @brief State of partition_by: each item is queued to lane selected by hash of its key. Each lane is drained in order by its own worker, results of all lanes are merged and emitted by thread which obtained result while no other thread is emitting.
+     */
+    template<rpp::constraint::decayed_type Type, rpp::constraint::observer Observer, typename Worker, typename KeyFn, typename Fn, rpp::details::disposables::constraint::disposables_container Container>
+    class partition_by_disposable final : public rpp::composite_disposable_impl<Container>
+        , public rpp::details::enable_wrapper_from_this<partition_by_disposable<Type, Observer, Worker, KeyFn, Fn, Container>>
+    {
+        using Result  = rpp::utils::extract_observer_type_t<Observer>;
+        using Wrapper = partition_by_disposable_wrapper<Type, Observer, Worker, KeyFn, Fn, Container>;
+
+        struct lane
+        {
+            lane(Worker&& w, size_t capacity)
+                : worker{std::move(w)}
+                , queue{capacity}
+                , ready{capacity}
+            {
+            }
+
+            RPP_NO_UNIQUE_ADDRESS Worker worker;
+
+            std::mutex                    mutex{};
+            std::condition_variable       has_space{};
+            rpp::utils::ring_buffer<Type> queue;
+            bool                          is_active{};
+
+            // items moved out of queue by lane's worker, accessed only by it
+            rpp::utils::ring_buffer<Type> ready;
+        };
+
+    public:
+        template<typename Scheduler>
+        partition_by_disposable(Observer&& observer, const KeyFn& key_fn, const Fn& fn, size_t partitions, const Scheduler& scheduler, size_t lane_capacity)
+            : m_observer{std::move(observer)}
+            , m_key_fn{key_fn}
+            , m_fn{fn}
+        {
+            for (size_t i = 0; i < partitions; ++i)
+                m_lanes.emplace_back(scheduler.create_worker(), lane_capacity);
+        }
+
+        // called only once during creation of state before any emission
+        void set_upstream(const disposable_wrapper& d) { m_observer.set_upstream(d); }
+
+        template<typename T>
+        void on_next(T&& v)
+        {
+            const size_t index = rpp::utils::hash{}(m_key_fn(rpp::utils::as_const(v))) % m_lanes.size();
+            auto&        lane  = m_lanes[index];
+
+            // counted before queueing to be sure that completion can't be emitted while item is queued
+            {
+                std::lock_guard lock{m_mutex};
+                ++m_in_flight;
+            }
+
+            std::unique_lock lock{lane.mutex};
+            lane.has_space.wait(lock, [&] { return !lane.queue.full() || this->is_disposed(); });
+            if (this->is_disposed())
+                return;
+
+            lane.queue.emplace_back(std::forward<T>(v));
+            if (std::exchange(lane.is_active, true))
+                return;
+
+            lock.unlock();
+            lane.worker.schedule([](const Wrapper& wrapper, size_t idx) { return wrapper.disposable->drain_lane(idx); },
+                                 Wrapper{this->wrapper_from_this().lock()},
+                                 index);
+        }
+
+        void on_error(const std::exception_ptr& err)
+        {
+            std::unique_lock lock{m_mutex};
+            if (!m_error)
+                m_error.emplace(err);
+            try_drain(lock);
+        }
+
+        void on_completed()
+        {
+            std::unique_lock lock{m_mutex};
+            m_completed = true;
+            try_drain(lock);
+        }
+
+    private:
+        schedulers::optional_delay_from_now drain_lane(size_t index)
+        {
+            auto& lane = m_lanes[index];
+            {
+                std::lock_guard lock{lane.mutex};
+                if (lane.queue.empty())
+                {
+                    lane.is_active = false;
+                    return std::nullopt;
+                }
+
+                std::swap(lane.queue, lane.ready);
+            }
+            lane.has_space.notify_all();
+
+            for (; !lane.ready.empty(); lane.ready.pop_front())
+            {
+                if (this->is_disposed())
+                    return std::nullopt;
+
+                auto result = m_fn(std::move(lane.ready.front()));
+
+                std::unique_lock lock{m_mutex};
+                m_pending.emplace_back(std::move(result));
+                try_drain(lock);
+            }
+
+            // re-schedule instead of looping to let other lanes sharing the same thread make progress
+            return schedulers::optional_delay_from_now{schedulers::duration{}};
+        }
+
+        void try_drain(std::unique_lock<std::mutex>& lock)
+        {
+            if (std::exchange(m_draining, true))
+                return;
+
+            while (true)
+            {
+                if (m_error)
+                {
+                    lock.unlock();
+                    m_observer.on_error(m_error.value());
+                    return;
+                }
+
+                if (m_pending.empty())
+                {
+                    if (m_completed && m_in_flight == 0)
+                    {
+                        lock.unlock();
+                        m_observer.on_completed();
+                        return;
+                    }
+
+                    m_draining = false;
+                    return;
+                }
+
+                std::swap(m_pending, m_emitting);
+                lock.unlock();
+
+                const auto count = m_emitting.size();
+                for (; !m_emitting.empty(); m_emitting.pop_front())
+                    m_observer.on_next(std::move(m_emitting.front()));
+
+                lock.lock();
+                m_in_flight -= count;
+            }
+        }
+
+        void composite_dispose_impl(interface_disposable::Mode) noexcept override
+        {
+            // wake up producer blocked by full lane to let it observe disposed state
+            for (auto& lane : m_lanes)
+            {
+                {
+                    std::lock_guard lock{lane.mutex};
+                }
+                lane.has_space.notify_all();
+            }
+        }
+
+    private:
+        RPP_NO_UNIQUE_ADDRESS Observer    m_observer;
+        RPP_NO_UNIQUE_ADDRESS const KeyFn m_key_fn;
+        RPP_NO_UNIQUE_ADDRESS const Fn    m_fn;
+        std::deque<lane>                  m_lanes{};
+
+        std::mutex                        m_mutex{};
+        size_t                            m_in_flight{};
+        bool                              m_draining{};
+        bool                              m_completed{};
+        std::optional<std::exception_ptr> m_error{};
+        rpp::utils::ring_buffer<Result>   m_pending{};
+        // results moved out by emitting thread, accessed only by it
+        rpp::utils::ring_buffer<Result> m_emitting{};
+    };
+
+    template<rpp::constraint::decayed_type Type, rpp::constraint::observer Observer, typename Worker, typename KeyFn, typename Fn, rpp::details::disposables::constraint::disposables_container Container>
+    struct partition_by_observer_strategy
+    {
+        static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::None;
+
+        std::shared_ptr<partition_by_disposable<Type, Observer, Worker, KeyFn, Fn, Container>> disposable{};
+
+        void set_upstream(const rpp::disposable_wrapper& d) const { disposable->add(d); }
+
+        bool is_disposed() const { return disposable->is_disposed(); }
+
+        template<typename T>
+        void on_next(T&& v) const
+        {
+            disposable->on_next(std::forward<T>(v));
+        }
+
+        void on_error(const std::exception_ptr& err) const { disposable->on_error(err); }
+
+        void on_completed() const { disposable->on_completed(); }
+    };
+
+    template<rpp::constraint::decayed_type KeyFn, rpp::schedulers::constraint::scheduler Scheduler, rpp::constraint::decayed_type Fn>
+    struct partition_by_t
+    {
+        template<rpp::constraint::decayed_type T>
+        struct operator_traits
+        {
+            static_assert(std::invocable<const KeyFn&, const T&>, "KeyFn is not invocable with T");
+            static_assert(std::invocable<const Fn&, T&&>, "Fn is not invocable with T");
+
+            using result_type = std::decay_t<std::invoke_result_t<const Fn&, T&&>>;
+        };
+
+        template<rpp::details::observables::constraint::disposables_strategy Prev>
+        using updated_optimal_disposables_strategy = rpp::details::observables::fixed_disposables_strategy<1>;
+
+        RPP_NO_UNIQUE_ADDRESS KeyFn     key_fn;
+        size_t                          partitions;
+        RPP_NO_UNIQUE_ADDRESS Scheduler scheduler;
+        RPP_NO_UNIQUE_ADDRESS Fn        fn;
+        size_t                          lane_capacity;
+
+        template<rpp::constraint::decayed_type Type, rpp::details::observables::constraint::disposables_strategy DisposableStrategy, rpp::constraint::observer Observer>
+        auto lift_with_disposables_strategy(Observer&& observer) const
+        {
+            using worker_t   = rpp::schedulers::utils::get_worker_t<Scheduler>;
+            using container  = typename DisposableStrategy::disposables_container;
+            using disposable = partition_by_disposable<Type, std::decay_t<Observer>, worker_t, KeyFn, Fn, container>;
+
+            const auto d   = disposable_wrapper_impl<disposable>::make(std::forward<Observer>(observer), key_fn, fn, std::max(partitions, size_t{1}), scheduler, lane_capacity);
+            auto       ptr = d.lock();
+            ptr->set_upstream(d.as_weak());
+            return rpp::observer<Type, partition_by_observer_strategy<Type, std::decay_t<Observer>, worker_t, KeyFn, Fn, container>>{std::move(ptr)};
+        }
+    };
+} // namespace rpp::operators::details
+
+namespace rpp::operators
+{
+    /**
+     * @brief Process items in parallel by fixed amount of lanes while keeping order of items with the same key: items are distributed to lanes by hash of key, each lane applies `fn` to its items in order on its own worker, results of all lanes are merged into resulting observable.
+     *
+     * @marble partition_by
+         {
+             source observable                             : +-a1-b1-a2-b2-|
+             operator "partition_by: key=letter, 2 lanes"  : +---b1-a1-b2-a2-|
+         }
+     *
+     * @details Actually this operator is a lightweight replacement of `group_by` + `observe_on` per group: amount of workers and queues is fixed by `partitions` instead of growing with amount of keys. Items with the same key always go to the same lane, so their results are emitted in original order. Results of different lanes are interleaved in order of obtaining.
+     * @details Each lane queues at most `lane_capacity` items (0 means unlimited): upstream's `on_next` blocks while lane of item is full. As a result, source should not emit from the same thread that processes lanes.
+     * @details `on_completed` is emitted after results of all items. Any error (from upstream or thrown by `fn`) is forwarded immediately and pending items are dropped.
+     * @warning `fn` is invoked concurrently from multiple threads (but never concurrently for the same lane).
+     *
+     * @par Performance notes:
+     * - 1 heap allocation for state + 1 worker and 1 queue per lane allocated on subscription
+     * - lane's worker takes all queued items of lane at once under single lock
+     * - results are merged via mutex and emitted in batches outside of it
+     *
+     * @param key_fn is function to obtain key of item. Key should be hashable via `std::hash`.
+     * @param partitions is amount of lanes
+     * @param scheduler provides worker for each lane, e.g. rpp::schedulers::thread_pool
+     * @param fn is function to apply to each item on lane's worker
+     * @param lane_capacity is maximum amount of queued items per lane, 0 means unlimited. Storage for `lane_capacity` items is allocated per lane on subscription.
+     *
+     * @note `#include <rpp/operators/partition_by.hpp>`
+     *
+     * @ingroup transforming_operators
+     */
+    template<typename KeyFn, rpp::schedulers::constraint::scheduler Scheduler, typename Fn>
+    auto partition_by(KeyFn&& key_fn, size_t partitions, Scheduler&& scheduler, Fn&& fn, size_t lane_capacity)
+    {
+        return details::partition_by_t<std::decay_t<KeyFn>, std::decay_t<Scheduler>, std::decay_t<Fn>>{std::forward<KeyFn>(key_fn), partitions, std::forward<Scheduler>(scheduler), std::forward<Fn>(fn), lane_capacity};
+    }
+} // namespace rpp::operators
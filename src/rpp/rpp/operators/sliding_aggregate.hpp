@@ -0,0 +1,315 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/operators/fwd.hpp>
+
+#include <rpp/defs.hpp>
+#include <rpp/operators/details/strategy.hpp>
+#include <rpp/schedulers/fwd.hpp>
+#include <rpp/utils/ring_buffer.hpp>
+#include <rpp/utils/utils.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace rpp::operators
+{
+    /**
+     * @brief Window of rpp::operators::sliding_aggregate: item is evicted when it becomes older than `max_count` last items or was emitted more than `duration` ago.
+     *
+     * @ingroup aggregate_operators
+     */
+    struct sliding_window
+    {
+        // maximum amount of items in window, 0 means unlimited
+        size_t max_count{};
+        // item stays in window during this duration since its emission, 0 means forever
+        rpp::schedulers::duration duration{};
+    };
+
+    /**
+     * @brief Ready-to-use monoids for rpp::operators::sliding_aggregate
+     *
+     * @details Monoid is any type providing:
+     * - `identity()` returning neutral aggregate
+     * - `combine(lhs, rhs)` associative combination of aggregates, where `lhs` is aggregate of older items
+     * - optional `lift(value)` converting item to aggregate (item is converted to aggregate type implicitly otherwise)
+     * - optional `subtract(aggregate, lifted_value)` removing oldest item from aggregate. Monoid with `subtract` is updated in O(1) per item, monoid without it is updated via two-stacks in O(1) amortized.
+     *
+     * @ingroup aggregate_operators
+     */
+    namespace monoids
+    {
+        template<rpp::constraint::decayed_type T>
+        struct sum
+        {
+            T identity() const { return T{}; }
+            T combine(const T& lhs, const T& rhs) const { return lhs + rhs; }
+            T subtract(const T& aggregate, const T& value) const { return aggregate - value; }
+        };
+
+        struct count
+        {
+            size_t identity() const { return 0; }
+            size_t combine(size_t lhs, size_t rhs) const { return lhs + rhs; }
+            size_t subtract(size_t aggregate, size_t value) const { return aggregate - value; }
+
+            template<typename T>
+            size_t lift(const T&) const
+            {
+                return 1;
+            }
+        };
+
+        template<rpp::constraint::decayed_type T>
+        struct min
+        {
+            T identity() const { return std::numeric_limits<T>::max(); }
+            T combine(const T& lhs, const T& rhs) const { return std::min(lhs, rhs); }
+        };
+
+        template<rpp::constraint::decayed_type T>
+        struct max
+        {
+            T identity() const { return std::numeric_limits<T>::lowest(); }
+            T combine(const T& lhs, const T& rhs) const { return std::max(lhs, rhs); }
+        };
+    } // namespace monoids
+} // namespace rpp::operators
+
+namespace rpp::operators::details
+{
+    template<typename Monoid>
+    using monoid_aggregate_t = std::decay_t<decltype(std::declval<const Monoid&>().identity())>;
+
+    template<typename Monoid>
+    concept monoid = requires(const Monoid& m, const monoid_aggregate_t<Monoid>& v) {
+        { m.combine(v, v) } -> std::convertible_to<monoid_aggregate_t<Monoid>>;
+    };
+
+    template<typename Monoid>
+    concept invertible_monoid = monoid<Monoid> && requires(const Monoid& m, const monoid_aggregate_t<Monoid>& v) {
+        { m.subtract(v, v) } -> std::convertible_to<monoid_aggregate_t<Monoid>>;
+    };
+
+    template<typename Monoid, typename T>
+    concept monoid_of = monoid<Monoid> && (requires(const Monoid& m, const T& v) { { m.lift(v) } -> std::convertible_to<monoid_aggregate_t<Monoid>>; } || std::convertible_to<const T&, monoid_aggregate_t<Monoid>>);
+
+    template<monoid Monoid, typename T>
+    monoid_aggregate_t<Monoid> lift_to_monoid(const Monoid& m, T&& v)
+    {
+        if constexpr (requires { m.lift(v); })
+            return m.lift(std::forward<T>(v));
+        else
+            return monoid_aggregate_t<Monoid>(std::forward<T>(v));
+    }
+
+    /**
+     * @brief Keeps aggregate of window updated on push and on eviction of oldest item by subtracting it
+     */
+    template<monoid Monoid>
+    class subtract_on_evict_aggregator
+    {
+        using Aggregate = monoid_aggregate_t<Monoid>;
+
+    public:
+        explicit subtract_on_evict_aggregator(const Monoid& m)
+            : m_aggregate{m.identity()}
+        {
+        }
+
+        size_t size() const { return m_items.size(); }
+
+        void push(const Monoid& m, Aggregate&& v)
+        {
+            m_aggregate = m.combine(m_aggregate, v);
+            m_items.emplace_back(std::move(v));
+        }
+
+        void pop(const Monoid& m)
+        {
+            m_aggregate = m.subtract(m_aggregate, m_items.front());
+            m_items.pop_front();
+        }
+
+        const Aggregate& query(const Monoid&) const { return m_aggregate; }
+
+    private:
+        rpp::utils::ring_buffer<Aggregate> m_items{};
+        Aggregate                          m_aggregate;
+    };
+
+    /**
+     * @brief Queue built of two stacks: "back" stack keeps aggregate of all its items, "front" stack keeps only aggregate of each item with all newer items of this stack. When "front" stack is empty during eviction, "back" stack is flipped into "front" one, so each item is combined at most twice.
+     */
+    template<monoid Monoid>
+    class two_stacks_aggregator
+    {
+        using Aggregate = monoid_aggregate_t<Monoid>;
+
+    public:
+        explicit two_stacks_aggregator(const Monoid& m)
+            : m_back_aggregate{m.identity()}
+        {
+        }
+
+        size_t size() const { return m_front.size() + m_back.size(); }
+
+        void push(const Monoid& m, Aggregate&& v)
+        {
+            m_back_aggregate = m.combine(m_back_aggregate, v);
+            m_back.push_back(std::move(v));
+        }
+
+        void pop(const Monoid& m)
+        {
+            if (m_front.empty())
+                flip(m);
+            m_front.pop_back();
+        }
+
+        Aggregate query(const Monoid& m) const
+        {
+            if (m_front.empty())
+                return m_back_aggregate;
+            return m.combine(m_front.back(), m_back_aggregate);
+        }
+
+    private:
+        void flip(const Monoid& m)
+        {
+            m_front.reserve(m_back.size());
+            for (auto it = m_back.rbegin(); it != m_back.rend(); ++it)
+            {
+                if (m_front.empty())
+                    m_front.push_back(std::move(*it));
+                else
+                    m_front.push_back(m.combine(*it, m_front.back()));
+            }
+
+            m_back.clear();
+            m_back_aggregate = m.identity();
+        }
+
+    private:
+        std::vector<Aggregate> m_front{};
+        std::vector<Aggregate> m_back{};
+        Aggregate              m_back_aggregate;
+    };
+
+    template<monoid Monoid>
+    using sliding_aggregator = std::conditional_t<invertible_monoid<Monoid>, subtract_on_evict_aggregator<Monoid>, two_stacks_aggregator<Monoid>>;
+
+    template<rpp::constraint::observer TObserver, rpp::constraint::decayed_type Monoid>
+    struct sliding_aggregate_observer_strategy
+    {
+        static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::None;
+
+        RPP_NO_UNIQUE_ADDRESS TObserver observer;
+        sliding_window                  window;
+        RPP_NO_UNIQUE_ADDRESS Monoid    monoid;
+
+        mutable sliding_aggregator<Monoid>                      aggregator{monoid};
+        mutable rpp::utils::ring_buffer<schedulers::time_point> timestamps{};
+
+        template<typename T>
+        void on_next(T&& v) const
+        {
+            if (window.duration != rpp::schedulers::duration{})
+            {
+                const auto now = rpp::schedulers::clock_type::now();
+                while (!timestamps.empty() && now - timestamps.front() >= window.duration)
+                {
+                    aggregator.pop(monoid);
+                    timestamps.pop_front();
+                }
+                timestamps.emplace_back(now);
+            }
+
+            aggregator.push(monoid, lift_to_monoid(monoid, std::forward<T>(v)));
+
+            if (window.max_count != 0 && aggregator.size() > window.max_count)
+            {
+                aggregator.pop(monoid);
+                if (!timestamps.empty())
+                    timestamps.pop_front();
+            }
+
+            observer.on_next(aggregator.query(monoid));
+        }
+
+        void on_error(const std::exception_ptr& err) const { observer.on_error(err); }
+
+        void on_completed() const { observer.on_completed(); }
+
+        void set_upstream(const disposable_wrapper& d) { observer.set_upstream(d); }
+
+        bool is_disposed() const { return observer.is_disposed(); }
+    };
+
+    template<rpp::constraint::decayed_type Monoid>
+    struct sliding_aggregate_t : lift_operator<sliding_aggregate_t<Monoid>, sliding_window, Monoid>
+    {
+        using lift_operator<sliding_aggregate_t<Monoid>, sliding_window, Monoid>::lift_operator;
+
+        template<rpp::constraint::decayed_type T>
+        struct operator_traits
+        {
+            static_assert(monoid_of<Monoid, T>, "Monoid is not able to aggregate T: it should provide identity(), combine(aggregate, aggregate) and lift(T) (or T should be convertible to aggregate)");
+
+            using result_type = monoid_aggregate_t<Monoid>;
+
+            template<rpp::constraint::observer_of_type<result_type> TObserver>
+            using observer_strategy = sliding_aggregate_observer_strategy<TObserver, Monoid>;
+        };
+
+        template<rpp::details::observables::constraint::disposables_strategy Prev>
+        using updated_optimal_disposables_strategy = Prev;
+    };
+} // namespace rpp::operators::details
+
+namespace rpp::operators
+{
+    /**
+     * @brief Emit aggregate of items inside sliding window for each emission from observable
+     *
+     * @marble sliding_aggregate
+     {
+         source observable                                  : +--1-2-3-4-|
+         operator "sliding_aggregate: {max_count=2}, sum"   : +--1-3-5-7-|
+     }
+     *
+     * @details Actually this operator keeps items of window in internal queue and updates aggregate incrementally on each emission: new item is combined with aggregate and items out of window are evicted from it, so window is never re-aggregated from scratch.
+     * @details Items out of `duration` are evicted lazily on next emission.
+     * @warning `subtract` of floating point monoids can accumulate rounding error over long streams.
+     *
+     * @par Performance notes:
+     * - monoid with `subtract` (sum, count): O(1) per emission, 1 combine + 1 subtract
+     * - monoid without `subtract` (min, max): O(1) amortized per emission via two-stacks, at most 3 combines per item
+     * - items of window are kept inside operator (as aggregates), heap allocation happens only when window grows over its previous size
+     *
+     * @param window is bounds of sliding window by count of items and/or by time
+     * @param monoid describes aggregation, see rpp::operators::monoids
+     *
+     * @note `#include <rpp/operators/sliding_aggregate.hpp>`
+     *
+     * @ingroup aggregate_operators
+     */
+    template<typename Monoid>
+    auto sliding_aggregate(const sliding_window& window, Monoid&& monoid)
+    {
+        static_assert(details::monoid<std::decay_t<Monoid>>, "Monoid should provide identity() and combine(aggregate, aggregate)");
+        return details::sliding_aggregate_t<std::decay_t<Monoid>>{window, std::forward<Monoid>(monoid)};
+    }
+} // namespace rpp::operators
@@ -17,7 +17,13 @@
 #include <rpp/operators/details/forwarding_subject.hpp>
 #include <rpp/operators/details/strategy.hpp>
 
+#include <algorithm>
 #include <cstddef>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
 
 namespace rpp
 {
@@ -126,6 +132,219 @@ namespace rpp::operators::details
         template<rpp::details::observables::constraint::disposables_strategy Prev>
         using updated_optimal_disposables_strategy = rpp::details::observables::fixed_disposables_strategy<1>;
     };
+
+    /**
+     * @brief State of window_with_time: all windows are opened and closed by single timer, which is re-scheduled to the nearest opening or closing of window.
+     */
+    template<rpp::constraint::observer TObserver, typename Worker>
+    class window_with_time_state final
+    {
+        using Observable = rpp::utils::extract_observer_type_t<TObserver>;
+        using value_type = rpp::utils::extract_observable_type_t<Observable>;
+        using Subject    = forwarding_subject<value_type>;
+
+        static_assert(std::same_as<Observable, decltype(std::declval<Subject>().get_observable())>);
+
+        struct window_data
+        {
+            rpp::schedulers::time_point                      close_time;
+            decltype(std::declval<Subject>().get_observer()) observer;
+            rpp::disposable_wrapper                          disposable;
+        };
+
+    public:
+        window_with_time_state(TObserver&& observer, Worker&& worker, rpp::schedulers::duration span, rpp::schedulers::duration shift)
+            : m_observer{std::move(observer)}
+            , m_worker{std::move(worker)}
+            , m_span{span}
+            , m_shift{shift}
+        {
+            m_observer.set_upstream(m_disposable->add_ref());
+        }
+
+        const std::shared_ptr<refcount_disposable>& get_disposable() const { return m_disposable; }
+
+        /**
+         * @brief Opens/closes windows due at `now` and returns time of the next opening or closing of window
+         */
+        rpp::schedulers::time_point on_timer(rpp::schedulers::time_point now)
+        {
+            std::vector<window_data>                   closed{};
+            std::optional<rpp::schedulers::time_point> open_time{};
+            rpp::schedulers::time_point                next{};
+            {
+                std::lock_guard lock{m_mutex};
+                while (!m_windows.empty() && m_windows.front().close_time <= now)
+                {
+                    closed.push_back(std::move(m_windows.front()));
+                    m_windows.pop_front();
+                }
+
+                if (m_next_open <= now)
+                {
+                    // openings missed due to late timer are skipped, so timer never falls behind
+                    m_next_open += (now - m_next_open) / m_shift * m_shift;
+                    open_time = m_next_open;
+                    m_next_open += m_shift;
+                }
+
+                next = m_windows.empty() ? m_next_open : std::min(m_next_open, m_windows.front().close_time);
+                if (open_time)
+                    next = std::min(next, open_time.value() + m_span);
+            }
+
+            // closed windows are not visible for other emissions anymore, so they are completed outside of lock
+            for (const auto& w : closed)
+            {
+                w.observer.on_completed();
+                m_disposable->remove(w.disposable);
+            }
+
+            if (open_time)
+                open_window(open_time.value());
+
+            return next;
+        }
+
+        template<typename T>
+        void on_next(T&& v)
+        {
+            std::lock_guard lock{m_mutex};
+            for (const auto& w : m_windows)
+                w.observer.on_next(v);
+        }
+
+        void on_error(const std::exception_ptr& err)
+        {
+            std::lock_guard emission_lock{m_emission_mutex};
+            for (const auto& w : extract_windows())
+                w.observer.on_error(err);
+            m_observer.on_error(err);
+        }
+
+        void on_completed()
+        {
+            std::lock_guard emission_lock{m_emission_mutex};
+            for (const auto& w : extract_windows())
+                w.observer.on_completed();
+            m_observer.on_completed();
+        }
+
+        void start(const std::shared_ptr<window_with_time_state>& self)
+        {
+            const auto now = m_worker.now();
+            m_next_open    = now;
+
+            struct handler
+            {
+                std::shared_ptr<window_with_time_state> state;
+
+                bool is_disposed() const { return state->get_disposable()->is_disposed(); }
+
+                void on_error(const std::exception_ptr& err) const { state->on_error(err); }
+            };
+
+            m_worker.schedule(
+                on_timer(now),
+                [](const handler& h) -> schedulers::optional_delay_to {
+                    return schedulers::optional_delay_to{h.state->on_timer(h.state->m_worker.now())};
+                },
+                handler{self});
+        }
+
+    private:
+        void open_window(rpp::schedulers::time_point open_time)
+        {
+            // emissions to observer are serialized with terminal events, but values are still emitted into opened windows meanwhile
+            std::lock_guard emission_lock{m_emission_mutex};
+            if (m_observer.is_disposed() || is_terminated())
+                return;
+
+            Subject subject{m_disposable->wrapper_from_this()};
+            m_observer.on_next(subject.get_observable());
+
+            // window obtains values only after observer obtains window itself
+            std::lock_guard lock{m_mutex};
+            m_windows.push_back(window_data{open_time + m_span, subject.get_observer(), subject.get_disposable()});
+            m_disposable->add(m_windows.back().disposable);
+        }
+
+        bool is_terminated()
+        {
+            std::lock_guard lock{m_mutex};
+            return m_terminated;
+        }
+
+        std::deque<window_data> extract_windows()
+        {
+            std::lock_guard lock{m_mutex};
+            m_terminated = true;
+            return std::exchange(m_windows, {});
+        }
+
+    private:
+        std::shared_ptr<refcount_disposable> m_disposable = disposable_wrapper_impl<refcount_disposable>::make().lock();
+        RPP_NO_UNIQUE_ADDRESS TObserver      m_observer;
+        RPP_NO_UNIQUE_ADDRESS Worker         m_worker;
+        const rpp::schedulers::duration      m_span;
+        const rpp::schedulers::duration      m_shift;
+
+        std::mutex                  m_emission_mutex{};
+        std::mutex                  m_mutex{};
+        std::deque<window_data>     m_windows{};
+        rpp::schedulers::time_point m_next_open{};
+        bool                        m_terminated{};
+    };
+
+    template<rpp::constraint::observer TObserver, typename Worker>
+    struct window_with_time_observer_strategy
+    {
+        static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::None;
+
+        std::shared_ptr<window_with_time_state<TObserver, Worker>> state{};
+
+        void set_upstream(const rpp::disposable_wrapper& d) const { state->get_disposable()->add(d); }
+
+        bool is_disposed() const { return state->get_disposable()->is_disposed(); }
+
+        template<typename T>
+        void on_next(T&& v) const
+        {
+            state->on_next(std::forward<T>(v));
+        }
+
+        void on_error(const std::exception_ptr& err) const { state->on_error(err); }
+
+        void on_completed() const { state->on_completed(); }
+    };
+
+    template<rpp::schedulers::constraint::scheduler Scheduler>
+    struct window_with_time_t
+    {
+        template<rpp::constraint::decayed_type T>
+        struct operator_traits
+        {
+            using result_type = window_observable<T>;
+        };
+
+        template<rpp::details::observables::constraint::disposables_strategy Prev>
+        using updated_optimal_disposables_strategy = rpp::details::observables::fixed_disposables_strategy<1>;
+
+        rpp::schedulers::duration       span;
+        rpp::schedulers::duration       shift;
+        RPP_NO_UNIQUE_ADDRESS Scheduler scheduler;
+
+        template<rpp::constraint::decayed_type Type, rpp::constraint::observer Observer>
+        auto lift(Observer&& observer) const
+        {
+            using worker_t = rpp::schedulers::utils::get_worker_t<Scheduler>;
+            using state_t  = window_with_time_state<std::decay_t<Observer>, worker_t>;
+
+            const auto state = std::make_shared<state_t>(std::forward<Observer>(observer), scheduler.create_worker(), span, shift);
+            state->start(state);
+            return rpp::observer<Type, window_with_time_observer_strategy<std::decay_t<Observer>, worker_t>>{state};
+        }
+    };
 } // namespace rpp::operators::details
 
 namespace rpp::operators
@@ -161,4 +380,60 @@ namespace rpp::operators
     {
         return details::window_t{count};
     }
+
+    /**
+     * @brief Subdivide original observable into sub-observables (window observables) by time: new window is opened every `shift` and each window is closed after `span` since its opening.
+     *
+     * @marble window_with_time
+       {
+           source observable              :  +-1-2-3-4-5-6-|
+
+           operator "window_with_time(4,4)" :
+                               {
+                                   +-1-2|
+                                   .....+3-4|
+                                   .........+5-6-|
+                               }
+       }
+     *
+     * @details `shift == span` provides tumbling (adjacent) windows, `shift < span` provides overlapping (sliding) windows where each item is emitted into multiple windows, `shift > span` provides windows with gaps where some items are not emitted into any window.
+     * @details First window is opened on subscription. All windows are opened and closed by single timer scheduled to the nearest opening or closing, not by subscription per window.
+     *
+     * @details Non-positive `span` is clamped to the smallest positive duration, non-positive `shift` is replaced with `span`.
+     *
+     * @par Performance notes:
+     * - 1 heap allocation for state + 1 subject per window
+     * - mutex acquired for each emission and each timer tick, windows are opened and closed outside of it
+     * - each item is copied into each window open at the moment
+     *
+     * @param span duration of each window
+     * @param shift period of opening of new windows
+     * @param scheduler is scheduler used to run timer
+     *
+     * @note `#include <rpp/operators/window.hpp>`
+     *
+     * @ingroup transforming_operators
+     * @see https://reactivex.io/documentation/operators/window.html
+     */
+    template<rpp::schedulers::constraint::scheduler Scheduler>
+    auto window_with_time(rpp::schedulers::duration span, rpp::schedulers::duration shift, Scheduler&& scheduler)
+    {
+        // zero span or shift would make timer fire at the same time point forever
+        span = std::max(span, rpp::schedulers::duration{1});
+        return details::window_with_time_t<std::decay_t<Scheduler>>{span, shift > rpp::schedulers::duration{} ? shift : span, std::forward<Scheduler>(scheduler)};
+    }
+
+    /**
+     * @brief Same as rpp::operators::window_with_time with `shift == span`: subdivide original observable into adjacent (tumbling) windows of `span` duration.
+     *
+     * @note `#include <rpp/operators/window.hpp>`
+     *
+     * @ingroup transforming_operators
+     * @see https://reactivex.io/documentation/operators/window.html
+     */
+    template<rpp::schedulers::constraint::scheduler Scheduler>
+    auto window_with_time(rpp::schedulers::duration span, Scheduler&& scheduler)
+    {
+        return window_with_time(span, span, std::forward<Scheduler>(scheduler));
+    }
 } // namespace rpp::operators
@@ -16,32 +16,66 @@
 #include <rpp/disposables/composite_disposable.hpp>
 #include <rpp/operators/details/strategy.hpp>
 #include <rpp/schedulers/current_thread.hpp>
+#include <rpp/utils/emitter_loop.hpp>
 #include <rpp/utils/utils.hpp>
 
 #include <memory>
+#include <optional>
 
 namespace rpp::operators::details
 {
+    /**
+     * @brief State of with_latest_from: latest values of "others" are published as snapshots, so emission from original observable reads them without locks. Emissions to observer are serialized via emitter loop.
+     */
     template<rpp::constraint::observer Observer, typename TSelector, rpp::constraint::decayed_type... RestArgs>
     class with_latest_from_disposable final : public composite_disposable
     {
+        struct completed
+        {
+        };
+
     public:
         explicit with_latest_from_disposable(Observer&& observer, const TSelector& selector)
-            : m_observer_with_mutex{std::move(observer)}
+            : m_observer{std::move(observer)}
             , m_selector{selector}
         {
         }
 
-        rpp::utils::pointer_under_lock<Observer> get_observer_under_lock() { return m_observer_with_mutex; }
+        // called only once during creation of state before any emission
+        void set_upstream(const disposable_wrapper& d) { m_observer.set_upstream(d); }
 
-        rpp::utils::tuple<rpp::utils::value_with_mutex<std::optional<RestArgs>>...>& get_values() { return m_values; }
+        rpp::utils::tuple<rpp::utils::snapshot_value<RestArgs>...>& get_values() { return m_values; }
 
         const TSelector& get_selector() const { return m_selector; }
 
+        template<typename T>
+        void on_next(T&& v)
+        {
+            m_emitter.emit(get_handler(), std::in_place_index<0>, std::forward<T>(v));
+        }
+
+        void on_error(const std::exception_ptr& err) { m_emitter.emit(get_handler(), std::in_place_index<1>, err); }
+
+        void on_completed() { m_emitter.emit(get_handler(), std::in_place_index<2>, completed{}); }
+
+    private:
+        auto get_handler()
+        {
+            return [this]<size_t I>(std::in_place_index_t<I>, auto&&... vals) {
+                if constexpr (I == 0)
+                    m_observer.on_next(std::forward<decltype(vals)>(vals)...);
+                else if constexpr (I == 1)
+                    m_observer.on_error(vals...);
+                else
+                    m_observer.on_completed();
+            };
+        }
+
     private:
-        rpp::utils::value_with_mutex<Observer>                                      m_observer_with_mutex{};
-        rpp::utils::tuple<rpp::utils::value_with_mutex<std::optional<RestArgs>>...> m_values{};
-        RPP_NO_UNIQUE_ADDRESS TSelector                                             m_selector;
+        Observer                                                                                                m_observer;
+        rpp::utils::emitter_loop<rpp::utils::extract_observer_type_t<Observer>, std::exception_ptr, completed> m_emitter{};
+        rpp::utils::tuple<rpp::utils::snapshot_value<RestArgs>...>                                              m_values{};
+        RPP_NO_UNIQUE_ADDRESS TSelector                                                                         m_selector;
     };
 
     template<size_t I, rpp::constraint::observer Observer, typename TSelector, rpp::constraint::decayed_type... RestArgs>
@@ -63,13 +97,12 @@ namespace rpp::operators::details
         template<typename T>
         void on_next(T&& v) const
         {
-            auto locked_value = disposable->get_values().template get<I>().lock();
-            locked_value->emplace(std::forward<T>(v));
+            disposable->get_values().template get<I>().store(std::forward<T>(v));
         }
 
         void on_error(const std::exception_ptr& err) const
         {
-            disposable->get_observer_under_lock()->on_error(err);
+            disposable->on_error(err);
         }
 
         static constexpr rpp::utils::empty_function_t<> on_completed{};
@@ -98,26 +131,26 @@ namespace rpp::operators::details
         template<typename T>
         void on_next(T&& v) const
         {
-            auto result = disposable->get_values().apply([&d = this->disposable, &v](rpp::utils::value_with_mutex<std::optional<RestArgs>>&... vals) -> std::optional<Result> {
-                auto lock = std::scoped_lock{vals.get_mutex()...};
-
-                if ((vals.get_value_unsafe().has_value() && ...))
-                    return d->get_selector()(rpp::utils::as_const(std::forward<T>(v)), rpp::utils::as_const(vals.get_value_unsafe().value())...);
-                return std::nullopt;
+            auto result = disposable->get_values().apply([&d = this->disposable, &v](const rpp::utils::snapshot_value<RestArgs>&... vals) {
+                return [&](const auto&... snapshots) -> std::optional<Result> {
+                    if ((static_cast<bool>(snapshots) && ...))
+                        return d->get_selector()(rpp::utils::as_const(std::forward<T>(v)), *snapshots...);
+                    return std::nullopt;
+                }(vals.load()...);
             });
 
             if (result.has_value())
-                disposable->get_observer_under_lock()->on_next(std::move(result).value());
+                disposable->on_next(std::move(result).value());
         }
 
         void on_error(const std::exception_ptr& err) const
         {
-            disposable->get_observer_under_lock()->on_error(err);
+            disposable->on_error(err);
         }
 
         void on_completed() const
         {
-            disposable->get_observer_under_lock()->on_completed();
+            disposable->on_completed();
         }
     };
 
@@ -154,7 +187,7 @@ namespace rpp::operators::details
 
             const auto disposable = disposable_wrapper_impl<Disposable>::make(std::forward<Observer>(observer), selector);
             auto       ptr        = disposable.lock();
-            ptr->get_observer_under_lock()->set_upstream(disposable.as_weak());
+            ptr->set_upstream(disposable.as_weak());
             subscribe(ptr, std::index_sequence_for<TObservables...>{}, observables...);
 
             return rpp::observer<Type, with_latest_from_observer_strategy<std::decay_t<Observer>, TSelector, Type, rpp::utils::extract_observable_type_t<TObservables>...>>{std::move(ptr)};
@@ -184,8 +217,8 @@ namespace rpp::operators
      *
      * @par Performance notes:
      * - 1 heap allocation for disposable
-     * - each value from "others" copied/moved to internal storage
-     * - mutex acquired every time value obtained
+     * - each value from "others" copied/moved to internal storage: trivially copyable values are published via seqlock, other values are published as immutable snapshots (+1 heap allocation per value)
+     * - emission from current observable reads latest values of "others" without locks, emissions to observer are serialized via lock-free queue
      *
      * @param selector is applied to current emission of current observable and latests emissions from observables
      * @param observables are observables whose emissions would be combined when current observable sends new value
@@ -220,8 +253,8 @@ namespace rpp::operators
      *
      * @par Performance notes:
      * - 1 heap allocation for disposable
-     * - each value from "others" copied/moved to internal storage
-     * - mutex acquired every time value obtained
+     * - each value from "others" copied/moved to internal storage: trivially copyable values are published via seqlock, other values are published as immutable snapshots (+1 heap allocation per value)
+     * - emission from current observable reads latest values of "others" without locks, emissions to observer are serialized via lock-free queue
      *
      * @param observables are observables whose emissions would be combined when current observable sends new value
      * @note `#include <rpp/operators/with_latest_from.hpp>`
@@ -15,60 +15,234 @@
 #include <rpp/defs.hpp>
 #include <rpp/operators/details/combining_strategy.hpp>
 #include <rpp/operators/details/strategy.hpp>
+#include <rpp/utils/exceptions.hpp>
+#include <rpp/utils/ring_buffer.hpp>
 
-#include <deque>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
 
 namespace rpp::operators::details
 {
     template<rpp::constraint::observer Observer, typename TSelector, rpp::constraint::decayed_type... Args>
-    class zip_disposable final : public combining_disposable<Observer>
+    class zip_disposable;
+} // namespace rpp::operators::details
+
+namespace rpp::operators
+{
+    /**
+     * @brief Metrics of rpp::operators::zip updated while operator works. Safe to read from any thread.
+     *
+     * @ingroup combining_operators
+     */
+    class zip_metrics
     {
     public:
-        explicit zip_disposable(Observer&& observer, const TSelector& selector)
-            : combining_disposable<Observer>(std::move(observer), sizeof...(Args))
-            , m_selector(selector)
+        explicit zip_metrics(size_t inputs_count)
+            : m_pending{std::make_unique<std::atomic_size_t[]>(inputs_count)}
+            , m_inputs_count{inputs_count}
         {
         }
 
-        const auto& get_selector() const { return m_selector; }
+        /**
+         * @brief Amount of values from observable with index `input` waiting for values from other observables. Index 0 is observable `zip` applied to.
+         */
+        size_t pending(size_t input) const { return input < m_inputs_count ? m_pending[input].load(std::memory_order::relaxed) : 0; }
+
+        /**
+         * @brief Total amount of values dropped due to `backpressure_overflow::DropNewest` or `backpressure_overflow::DropOldest`
+         */
+        size_t dropped() const { return m_dropped.load(std::memory_order::relaxed); }
 
-        auto& get_pendings() { return m_pendings; }
+        size_t inputs_count() const { return m_inputs_count; }
 
     private:
-        utils::tuple<std::deque<Args>...> m_pendings{};
+        template<rpp::constraint::observer Observer, typename TSelector, rpp::constraint::decayed_type... Args>
+        friend class details::zip_disposable;
 
-        RPP_NO_UNIQUE_ADDRESS TSelector m_selector;
+        void set_pending(size_t input, size_t count)
+        {
+            if (input < m_inputs_count)
+                m_pending[input].store(count, std::memory_order::relaxed);
+        }
+
+        void add_dropped() { m_dropped.fetch_add(1, std::memory_order::relaxed); }
+
+    private:
+        std::unique_ptr<std::atomic_size_t[]> m_pending;
+        std::atomic_size_t                    m_dropped{};
+        size_t                                m_inputs_count;
     };
 
-    template<size_t I, rpp::constraint::observer Observer, typename TSelector, rpp::constraint::decayed_type... Args>
-    struct zip_observer_strategy final
-        : public combining_observer_strategy<zip_disposable<Observer, TSelector, Args...>>
+    /**
+     * @brief Options of rpp::operators::zip limiting amount of values waiting for pair from other observables.
+     *
+     * @ingroup combining_operators
+     */
+    struct zip_options
     {
-        using combining_observer_strategy<zip_disposable<Observer, TSelector, Args...>>::disposable;
+        // maximum amount of pending values per observable, 0 means unbounded
+        size_t capacity{};
+        // what to do when value arrives while pending values of its observable already reached capacity
+        backpressure_overflow overflow = backpressure_overflow::Error;
+        // optional metrics to be updated by operator
+        std::shared_ptr<zip_metrics> metrics{};
+    };
+} // namespace rpp::operators
 
-        template<typename T>
-        void on_next(T&& v) const
+namespace rpp::operators::details
+{
+    template<rpp::constraint::observer Observer, typename TSelector, rpp::constraint::decayed_type... Args>
+    class zip_disposable final : public combining_disposable<zip_disposable<Observer, TSelector, Args...>, Observer, Args...>
+    {
+        using base = combining_disposable<zip_disposable<Observer, TSelector, Args...>, Observer, Args...>;
+
+    public:
+        explicit zip_disposable(Observer&& observer, const TSelector& selector, const zip_options& options)
+            : base(std::move(observer))
+            , m_pendings{rpp::utils::ring_buffer<Args>(options.capacity)...}
+            , m_selector(selector)
+            , m_metrics{options.metrics}
+            , m_capacity{options.capacity}
+            , m_overflow{options.overflow}
         {
-            const auto observer = disposable->get_observer_under_lock();
-            disposable->get_pendings().template get<I>().push_back(std::forward<T>(v));
+        }
+
+        /**
+         * @brief For `backpressure_overflow::Block` waits till observable with index `I` has free slot and occupies it. Returns false if disposed meanwhile.
+         */
+        template<size_t I>
+        bool acquire_slot()
+        {
+            if (!is_blocking())
+                return true;
+
+            std::unique_lock lock{m_slots_mutex};
+            m_has_slot.wait(lock, [&] { return m_occupied_slots[I] < m_capacity || this->is_disposed(); });
+            if (this->is_disposed())
+                return false;
 
-            disposable->get_pendings().apply(&apply_impl<decltype(disposable)>, disposable, observer);
+            ++m_occupied_slots[I];
+            return true;
+        }
+
+        template<size_t I, typename T>
+        void emit_next(T&& v)
+        {
+            auto& pending = m_pendings.template get<I>();
+            if (pending.full())
+            {
+                switch (m_overflow)
+                {
+                case backpressure_overflow::DropNewest:
+                    on_dropped();
+                    return;
+                case backpressure_overflow::DropOldest:
+                    pending.pop_front();
+                    on_dropped();
+                    break;
+                case backpressure_overflow::Error:
+                case backpressure_overflow::Block:
+                    m_pendings.apply(&clear_impl, this);
+                    this->get_observer().on_error(std::make_exception_ptr(rpp::utils::buffer_overflow{"zip: capacity exceeded"}));
+                    return;
+                }
+            }
+
+            pending.emplace_back(std::forward<T>(v));
+            m_pendings.apply(&apply_impl, this);
         }
 
     private:
-        template<typename TDisposable>
-        static void apply_impl(const TDisposable& disposable, const rpp::utils::pointer_under_lock<Observer>& observer, std::deque<Args>&... values)
+        bool is_blocking() const { return m_capacity != 0 && m_overflow == backpressure_overflow::Block; }
+
+        void on_dropped() const
+        {
+            if (m_metrics)
+                m_metrics->add_dropped();
+        }
+
+        void release_slots()
+        {
+            {
+                std::lock_guard lock{m_slots_mutex};
+                for (auto& count : m_occupied_slots)
+                    --count;
+            }
+            m_has_slot.notify_all();
+        }
+
+        void update_metrics(rpp::utils::ring_buffer<Args>&... values) const
+        {
+            if (!m_metrics)
+                return;
+
+            size_t i{};
+            (m_metrics->set_pending(i++, values.size()), ...);
+        }
+
+        void composite_dispose_impl(interface_disposable::Mode) noexcept override
+        {
+            // wake up producers blocked by `backpressure_overflow::Block` to let them observe disposed state
+            if (!is_blocking())
+                return;
+            {
+                std::lock_guard lock{m_slots_mutex};
+            }
+            m_has_slot.notify_all();
+        }
+
+        static void clear_impl(zip_disposable* disposable, rpp::utils::ring_buffer<Args>&... values)
+        {
+            (values.clear(), ...);
+            disposable->update_metrics(values...);
+        }
+
+        static void apply_impl(zip_disposable* disposable, rpp::utils::ring_buffer<Args>&... values)
         {
             if ((!values.empty() && ...))
             {
-                observer->on_next(disposable->get_selector()(std::move(values.front())...));
+                disposable->get_observer().on_next(disposable->m_selector(std::move(values.front())...));
                 (values.pop_front(), ...);
+
+                if (disposable->is_blocking())
+                    disposable->release_slots();
             }
+            disposable->update_metrics(values...);
+        }
+
+    private:
+        utils::tuple<rpp::utils::ring_buffer<Args>...> m_pendings;
+
+        RPP_NO_UNIQUE_ADDRESS TSelector m_selector;
+
+        std::shared_ptr<zip_metrics> m_metrics;
+        const size_t                 m_capacity;
+        const backpressure_overflow  m_overflow;
+
+        std::mutex                          m_slots_mutex{};
+        std::condition_variable             m_has_slot{};
+        std::array<size_t, sizeof...(Args)> m_occupied_slots{};
+    };
+
+    template<size_t I, rpp::constraint::observer Observer, typename TSelector, rpp::constraint::decayed_type... Args>
+    struct zip_observer_strategy final
+        : public combining_observer_strategy<zip_disposable<Observer, TSelector, Args...>>
+    {
+        using combining_observer_strategy<zip_disposable<Observer, TSelector, Args...>>::disposable;
+
+        template<typename T>
+        void on_next(T&& v) const
+        {
+            if (disposable->template acquire_slot<I>())
+                disposable->template on_next<I>(std::forward<T>(v));
         }
     };
 
     template<typename TSelector, rpp::constraint::observable... TObservables>
-    struct zip_t : public combining_operator_t<zip_disposable, zip_observer_strategy, TSelector, TObservables...>
+    struct zip_t : public combining_operator_t<zip_disposable, zip_observer_strategy, TSelector, zip_options, TObservables...>
     {
     };
 } // namespace rpp::operators::details
@@ -88,8 +262,8 @@ namespace rpp::operators
      *
      * @par Performance notes:
      * - 1 heap allocation for disposable
-     * - each value from any observable copied/moved to internal storage
-     * - mutex acquired every time value obtained
+     * - each value from any observable copied/moved to internal storage (unbounded, see overload with rpp::operators::zip_options to limit it)
+     * - emissions are serialized via lock-free queue: value obtained while another observable is emitting is queued and zipped by emitting thread
      *
      * @param selector is applied to current emission of current observable and latests emissions from observables
      * @param observables are observables whose emissions would be zipped with current observable
@@ -99,12 +273,10 @@ namespace rpp::operators
      * @see https://reactivex.io/documentation/operators/zip.html
      */
     template<typename TSelector, rpp::constraint::observable TObservable, rpp::constraint::observable... TObservables>
-        requires (!rpp::constraint::observable<TSelector> && (!utils::is_not_template_callable<TSelector> || std::invocable<TSelector, rpp::utils::convertible_to_any, utils::extract_observable_type_t<TObservable>, utils::extract_observable_type_t<TObservables>...>))
+        requires (!rpp::constraint::observable<TSelector> && !std::same_as<std::decay_t<TSelector>, zip_options> && (!utils::is_not_template_callable<TSelector> || std::invocable<TSelector, rpp::utils::convertible_to_any, utils::extract_observable_type_t<TObservable>, utils::extract_observable_type_t<TObservables>...>))
     auto zip(TSelector&& selector, TObservable&& observable, TObservables&&... observables)
     {
-        return details::zip_t<std::decay_t<TSelector>, std::decay_t<TObservable>, std::decay_t<TObservables>...>{
-            rpp::utils::tuple{std::forward<TObservable>(observable), std::forward<TObservables>(observables)...},
-            std::forward<TSelector>(selector)};
+        return zip(zip_options{}, std::forward<TSelector>(selector), std::forward<TObservable>(observable), std::forward<TObservables>(observables)...);
     }
 
     /**
@@ -120,8 +292,8 @@ namespace rpp::operators
      *
      * @par Performance notes:
      * - 1 heap allocation for disposable
-     * - each value from any observable copied/moved to internal storage
-     * - mutex acquired every time value obtained
+     * - each value from any observable copied/moved to internal storage (unbounded, see overload with rpp::operators::zip_options to limit it)
+     * - emissions are serialized via lock-free queue: value obtained while another observable is emitting is queued and zipped by emitting thread
      *
      * @param observables are observables whose emissions would be zipped with current observable
      * @note `#include <rpp/operators/zip.hpp>`
@@ -134,4 +306,55 @@ namespace rpp::operators
     {
         return zip(rpp::utils::pack_to_tuple{}, std::forward<TObservable>(observable), std::forward<TObservables>(observables)...);
     }
+
+    /**
+     * @brief combines emissions from observables and emit single items for each combination based on the results of provided selector. Amount of values waiting for pair from other observables is limited by `options.capacity` per observable.
+     *
+     * @details When value arrives while pending values of its observable already reached capacity, `options.overflow` is applied:
+     * - `backpressure_overflow::DropNewest` - new value is dropped
+     * - `backpressure_overflow::DropOldest` - the oldest pending value of the same observable is dropped and new one is queued
+     * - `backpressure_overflow::Error` - pending values are cleared, sources are disposed and `rpp::utils::buffer_overflow` is emitted
+     * - `backpressure_overflow::Block` - producer is blocked till the oldest pending value of its observable is zipped
+     *
+     * @warning `backpressure_overflow::Block` deadlocks if blocked producer is the only one able to provide values for other observables (for example, all observables emit from the same thread).
+     *
+     * @par Performance notes:
+     * - 1 heap allocation for disposable
+     * - storage for `options.capacity` values per observable is allocated once (for non-zero capacity)
+     * - value obtained while another observable is emitting is queued via lock-free queue, which allocates node per such value
+     * - `backpressure_overflow::Block` additionally locks mutex per value
+     *
+     * @param options capacity, overflow policy and optional rpp::operators::zip_metrics to report pending values per observable and amount of dropped values
+     * @param selector is applied to current emission of current observable and latests emissions from observables
+     * @param observables are observables whose emissions would be zipped with current observable
+     * @note `#include <rpp/operators/zip.hpp>`
+     *
+     * @ingroup combining_operators
+     * @see https://reactivex.io/documentation/operators/zip.html
+     */
+    template<typename TSelector, rpp::constraint::observable TObservable, rpp::constraint::observable... TObservables>
+        requires (!rpp::constraint::observable<TSelector> && (!utils::is_not_template_callable<TSelector> || std::invocable<TSelector, rpp::utils::convertible_to_any, utils::extract_observable_type_t<TObservable>, utils::extract_observable_type_t<TObservables>...>))
+    auto zip(const zip_options& options, TSelector&& selector, TObservable&& observable, TObservables&&... observables)
+    {
+        return details::zip_t<std::decay_t<TSelector>, std::decay_t<TObservable>, std::decay_t<TObservables>...>{
+            rpp::utils::tuple{std::forward<TObservable>(observable), std::forward<TObservables>(observables)...},
+            std::forward<TSelector>(selector),
+            options};
+    }
+
+    /**
+     * @brief Same as rpp::operators::zip with options and selector, but emits tuple of items for each combination
+     *
+     * @param options capacity, overflow policy and optional rpp::operators::zip_metrics
+     * @param observables are observables whose emissions would be zipped with current observable
+     * @note `#include <rpp/operators/zip.hpp>`
+     *
+     * @ingroup combining_operators
+     * @see https://reactivex.io/documentation/operators/zip.html
+     */
+    template<rpp::constraint::observable TObservable, rpp::constraint::observable... TObservables>
+    auto zip(const zip_options& options, TObservable&& observable, TObservables&&... observables)
+    {
+        return zip(options, rpp::utils::pack_to_tuple{}, std::forward<TObservable>(observable), std::forward<TObservables>(observables)...);
+    }
 } // namespace rpp::operators
@@ -25,6 +25,7 @@
 #include <rpp/sources/empty.hpp>
 #include <rpp/sources/error.hpp>
 #include <rpp/sources/from.hpp>
+#include <rpp/sources/from_mapped_file.hpp>
 #include <rpp/sources/interval.hpp>
 #include <rpp/sources/never.hpp>
 #include <rpp/sources/timer.hpp>
@@ -17,9 +17,14 @@
 #include <rpp/schedulers/current_thread.hpp>
 #include <rpp/utils/utils.hpp>
 
+#include <algorithm>
 #include <array>
 #include <exception>
+#include <iterator>
 #include <memory>
+#include <optional>
+#include <ranges>
+#include <span>
 #include <type_traits>
 #include <utility>
 
@@ -48,25 +53,117 @@ namespace rpp::details
         std::shared_ptr<Container> m_container{};
     };
 
+    /**
+     * @brief Non-owning view over contiguous range which keeps owner of this range alive.
+     */
+    template<constraint::decayed_type T>
+    class shared_span_container
+    {
+    public:
+        template<typename Range>
+        explicit shared_span_container(std::shared_ptr<Range>&& owner)
+            : m_span{*owner}
+            , m_owner{std::move(owner)}
+        {
+        }
+
+        auto begin() const { return m_span.begin(); }
+
+        auto end() const { return m_span.end(); }
+
+    private:
+        std::span<const T>          m_span;
+        std::shared_ptr<const void> m_owner;
+    };
+
+    /**
+     * @brief Holder of C++20 view to iterate over it as regular container.
+     * @details Some views (e.g. `std::views::filter`) can be iterated only as non-const ones due to caching inside. It is safe due to each subscription iterates over own copy of view.
+     */
+    template<std::ranges::view View>
+        requires std::copyable<View>
+    class range_container
+    {
+    public:
+        explicit range_container(const View& view)
+            : m_view{view}
+        {
+        }
+
+        auto begin() const { return std::ranges::begin(m_view); }
+
+        auto end() const { return std::ranges::end(m_view); }
+
+    private:
+        mutable View m_view;
+    };
+
+    /**
+     * @brief Position of from_iterable inside of container between schedulings: index plus cached iterator to avoid re-advancing from begin on each scheduling.
+     * @details Cached iterator points into container stored next to this position inside of schedulable, so it is dropped on any copy/move and re-obtained from index.
+     */
+    template<typename Iterator>
+    class from_iterable_position
+    {
+    public:
+        from_iterable_position() = default;
+
+        from_iterable_position(const from_iterable_position& other)
+            : m_index{other.m_index}
+        {
+        }
+
+        from_iterable_position(from_iterable_position&& other) noexcept
+            : m_index{other.m_index}
+        {
+        }
+
+        from_iterable_position& operator=(const from_iterable_position&)     = delete;
+        from_iterable_position& operator=(from_iterable_position&&) noexcept = delete;
+
+        template<typename PackedContainer>
+        Iterator& get(const PackedContainer& cont)
+        {
+            if (!m_itr)
+                m_itr.emplace(std::next(std::cbegin(cont), static_cast<std::iter_difference_t<Iterator>>(m_index)));
+            return m_itr.value();
+        }
+
+        void advance()
+        {
+            ++m_itr.value();
+            ++m_index;
+        }
+
+    private:
+        size_t                  m_index{};
+        std::optional<Iterator> m_itr{};
+    };
+
+    template<typename PackedContainer>
+    using from_iterable_position_t = from_iterable_position<decltype(std::cbegin(std::declval<const PackedContainer&>()))>;
+
     struct from_iterable_schedulable
     {
         template<constraint::decayed_type PackedContainer, constraint::observer_strategy<utils::iterable_value_t<PackedContainer>> Strategy>
-        rpp::schedulers::optional_delay_from_now operator()(const observer<utils::iterable_value_t<PackedContainer>, Strategy>& obs, const PackedContainer& cont, size_t& index) const
+        rpp::schedulers::optional_delay_from_now operator()(const observer<utils::iterable_value_t<PackedContainer>, Strategy>& obs, const PackedContainer& cont, from_iterable_position_t<PackedContainer>& position, size_t batch_size) const
         {
             try
             {
-                auto itr = std::cbegin(cont);
-                auto end = std::cend(cont);
-                std::advance(itr, static_cast<int64_t>(index));
+                auto&      itr = position.get(cont);
+                const auto end = std::cend(cont);
 
-                if (itr != end)
+                // completion is sent in the same execution as last item, so end is checked before batch limit
+                for (size_t emitted = 0; itr != end; ++emitted)
                 {
-                    obs.on_next(utils::as_const(*itr));
-                    if (std::next(itr) != end) // it was not last
-                    {
-                        ++index;
+                    if (emitted == batch_size)
                         return schedulers::delay_from_now{}; // re-schedule this
-                    }
+
+                    if (emitted != 0 && obs.is_disposed())
+                        return std::nullopt;
+
+                    obs.on_next(utils::as_const(*itr));
+                    position.advance();
                 }
 
                 obs.on_completed();
@@ -87,15 +184,17 @@ namespace rpp::details
         using optimal_disposables_strategy = rpp::details::observables::fixed_disposables_strategy<0>;
 
         template<typename... Args>
-        from_iterable_strategy(const TScheduler& scheduler, Args&&... args)
+        from_iterable_strategy(const TScheduler& scheduler, size_t batch_size, Args&&... args)
             : container{std::forward<Args>(args)...}
             , scheduler{scheduler}
+            , batch_size{std::max(batch_size, size_t{1})}
         {
         }
 
 
         RPP_NO_UNIQUE_ADDRESS PackedContainer container;
         RPP_NO_UNIQUE_ADDRESS TScheduler      scheduler;
+        size_t                                batch_size;
 
         template<constraint::observer_strategy<utils::iterable_value_t<PackedContainer>> Strategy>
         void subscribe(observer<utils::iterable_value_t<PackedContainer>, Strategy>&& obs) const
@@ -122,16 +221,35 @@ namespace rpp::details
             else
             {
                 const auto worker = scheduler.create_worker();
-                worker.schedule(from_iterable_schedulable{}, std::move(obs), container, size_t{});
+                worker.schedule(from_iterable_schedulable{}, std::move(obs), container, from_iterable_position_t<PackedContainer>{}, size_t{batch_size});
             }
         }
     };
 
+    template<std::ranges::view View, schedulers::constraint::scheduler TScheduler>
+    struct from_range_strategy
+    {
+    public:
+        using value_type                   = rpp::utils::iterable_value_t<range_container<View>>;
+        using optimal_disposables_strategy = rpp::details::observables::fixed_disposables_strategy<0>;
+
+        RPP_NO_UNIQUE_ADDRESS View       view;
+        RPP_NO_UNIQUE_ADDRESS TScheduler scheduler;
+        size_t                           batch_size;
+
+        template<constraint::observer_strategy<value_type> Strategy>
+        void subscribe(observer<value_type, Strategy>&& obs) const
+        {
+            // each subscription obtains own copy of view
+            from_iterable_strategy<range_container<View>, TScheduler>{scheduler, batch_size, view}.subscribe(std::move(obs));
+        }
+    };
+
     template<typename PackedContainer, schedulers::constraint::scheduler TScheduler, typename... Args>
-    auto make_from_iterable_observable(const TScheduler& scheduler, Args&&... args)
+    auto make_from_iterable_observable(const TScheduler& scheduler, size_t batch_size, Args&&... args)
     {
         return observable<utils::iterable_value_t<std::decay_t<PackedContainer>>,
-                          details::from_iterable_strategy<std::decay_t<PackedContainer>, TScheduler>>{scheduler, std::forward<Args>(args)...};
+                          details::from_iterable_strategy<std::decay_t<PackedContainer>, TScheduler>>{scheduler, batch_size, std::forward<Args>(args)...};
     }
 
     struct from_callable_invoke
@@ -163,8 +281,12 @@ namespace rpp::source
        }
      *
      * @tparam memory_model rpp::memory_model strategy used to handle provided iterable
-     * @param scheduler is scheduler used for scheduling of submissions: next item will be submitted to scheduler when previous one is executed
+     * @param scheduler is scheduler used for scheduling of submissions: next batch of items will be submitted to scheduler when previous one is executed
      * @param iterable container with values which will be flattened
+     * @param batch_size is amount of items emitted during one execution of scheduled action. Bigger values make iteration cheaper for non-immediate schedulers, but other scheduled actions get less chances to interleave.
+     *
+     * @par Performance notes:
+     * - position inside of iterable is kept between schedulings, so each item costs O(1) even for non-random-access containers like `std::list` or `std::set`
      *
      * @par Examples:
      * @snippet from.cpp from_iterable
@@ -175,10 +297,91 @@ namespace rpp::source
      * @see https://reactivex.io/documentation/operators/from.html
      */
     template<constraint::memory_model MemoryModel /* = memory_model::use_stack*/, constraint::iterable Iterable, schedulers::constraint::scheduler TScheduler /* = rpp::schedulers::defaults::iteration_scheduler*/>
-    auto from_iterable(Iterable&& iterable, const TScheduler& scheduler /* = TScheduler{}*/)
+    auto from_iterable(Iterable&& iterable, const TScheduler& scheduler /* = TScheduler{}*/, size_t batch_size /* = 1 */)
     {
         using container = std::conditional_t<std::same_as<MemoryModel, rpp::memory_model::use_stack>, std::decay_t<Iterable>, details::shared_container<std::decay_t<Iterable>>>;
-        return details::make_from_iterable_observable<container>(scheduler, std::forward<Iterable>(iterable));
+        return details::make_from_iterable_observable<container>(scheduler, batch_size, std::forward<Iterable>(iterable));
+    }
+
+    /**
+     * @brief Creates observable that emits items of contiguous range without copying of it.
+     *
+     * @marble from_span
+       {
+           operator "from_span({1,2,3,5})": +-1-2-3-5-|
+       }
+     *
+     * @details Observable keeps only pointer and size of provided range, so original range should outlive observable and all of its subscriptions. Ranges which don't guarantee it (like temporary containers) are rejected at compile time.
+     *
+     * @par Performance notes:
+     * - no any copies of items or range itself
+     *
+     * @param range is contiguous range (like `std::vector`, `std::array` or `std::span`) to emit items from
+     * @param scheduler is scheduler used for scheduling of submissions: next batch of items will be submitted to scheduler when previous one is executed
+     * @param batch_size is amount of items emitted during one execution of scheduled action
+     *
+     * @ingroup creational_operators
+     * @see https://reactivex.io/documentation/operators/from.html
+     */
+    template<std::ranges::contiguous_range Range, schedulers::constraint::scheduler TScheduler /* = rpp::schedulers::defaults::iteration_scheduler*/>
+        requires (std::ranges::borrowed_range<Range> && std::ranges::sized_range<Range>)
+    auto from_span(Range&& range, const TScheduler& scheduler /* = TScheduler{}*/, size_t batch_size /* = 1 */)
+    {
+        using span = std::span<const std::ranges::range_value_t<Range>>;
+        return details::make_from_iterable_observable<span>(scheduler, batch_size, span{std::forward<Range>(range)});
+    }
+
+    /**
+     * @brief Creates observable that emits items of contiguous range owned by shared_ptr without copying of it.
+     *
+     * @marble from_span
+       {
+           operator "from_span(std::make_shared<std::vector<int>>({1,2,3,5}))": +-1-2-3-5-|
+       }
+     *
+     * @details Observable shares ownership over range, so range is alive till observable and all of its subscriptions are alive. It is zero-copy alternative to `from_iterable<rpp::memory_model::use_shared>` when range is already owned by shared_ptr.
+     * @warning Range should not be modified while observable is alive.
+     *
+     * @param owner is shared_ptr to contiguous range to emit items from
+     * @param scheduler is scheduler used for scheduling of submissions: next batch of items will be submitted to scheduler when previous one is executed
+     * @param batch_size is amount of items emitted during one execution of scheduled action
+     *
+     * @ingroup creational_operators
+     * @see https://reactivex.io/documentation/operators/from.html
+     */
+    template<std::ranges::contiguous_range Range, schedulers::constraint::scheduler TScheduler /* = rpp::schedulers::defaults::iteration_scheduler*/>
+        requires std::ranges::sized_range<Range>
+    auto from_span(std::shared_ptr<Range> owner, const TScheduler& scheduler /* = TScheduler{}*/, size_t batch_size /* = 1 */)
+    {
+        using container = details::shared_span_container<std::ranges::range_value_t<Range>>;
+        return details::make_from_iterable_observable<container>(scheduler, batch_size, std::move(owner));
+    }
+
+    /**
+     * @brief Creates observable that lazily emits items of C++20 range or view.
+     *
+     * @marble from_range
+       {
+           operator "from_range(std::views::iota(1) | std::views::take(4))": +-1-2-3-4-|
+       }
+     *
+     * @details Range is converted to view via `std::views::all`: views are copied, lvalue containers are referenced (so they should outlive observable). Each subscription iterates over own copy of view, so items are calculated lazily during emission.
+     * @details Views owning rvalue containers are move-only and can't be shared between subscriptions, so they are rejected at compile time: use rpp::source::from_iterable for such containers.
+     *
+     * @param range is range or view to emit items from
+     * @param scheduler is scheduler used for scheduling of submissions: next batch of items will be submitted to scheduler when previous one is executed
+     * @param batch_size is amount of items emitted during one execution of scheduled action
+     *
+     * @ingroup creational_operators
+     * @see https://reactivex.io/documentation/operators/from.html
+     */
+    template<std::ranges::viewable_range Range, schedulers::constraint::scheduler TScheduler /* = rpp::schedulers::defaults::iteration_scheduler*/>
+        requires std::copyable<std::views::all_t<Range>>
+    auto from_range(Range&& range, const TScheduler& scheduler /* = TScheduler{}*/, size_t batch_size /* = 1 */)
+    {
+        using view     = std::views::all_t<Range>;
+        using strategy = details::from_range_strategy<view, TScheduler>;
+        return observable<typename strategy::value_type, strategy>{std::views::all(std::forward<Range>(range)), scheduler, batch_size};
     }
 
     /**
@@ -208,7 +411,7 @@ namespace rpp::source
     {
         using inner_container = std::array<std::decay_t<T>, sizeof...(Ts) + 1>;
         using container       = std::conditional_t<std::same_as<MemoryModel, rpp::memory_model::use_stack>, inner_container, details::shared_container<inner_container>>;
-        return details::make_from_iterable_observable<container>(scheduler, std::forward<T>(item), std::forward<Ts>(items)...);
+        return details::make_from_iterable_observable<container>(scheduler, size_t{1}, std::forward<T>(item), std::forward<Ts>(items)...);
     }
 
     /**
@@ -238,7 +441,7 @@ namespace rpp::source
     {
         using inner_container = std::array<std::decay_t<T>, sizeof...(Ts) + 1>;
         using container       = std::conditional_t<std::same_as<MemoryModel, rpp::memory_model::use_stack>, inner_container, details::shared_container<inner_container>>;
-        return details::make_from_iterable_observable<container>(rpp::schedulers::defaults::iteration_scheduler{}, std::forward<T>(item), std::forward<Ts>(items)...);
+        return details::make_from_iterable_observable<container>(rpp::schedulers::defaults::iteration_scheduler{}, size_t{1}, std::forward<T>(item), std::forward<Ts>(items)...);
     }
 
     /**
@@ -0,0 +1,127 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/sources/fwd.hpp>
+
+#include <rpp/defs.hpp>
+#include <rpp/observables/observable.hpp>
+#include <rpp/schedulers/current_thread.hpp>
+#include <rpp/utils/mapped_file.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <filesystem>
+#include <memory>
+#include <span>
+
+namespace rpp::details
+{
+    struct from_mapped_file_schedulable
+    {
+        template<constraint::observer_strategy<std::span<const std::byte>> Strategy>
+        rpp::schedulers::optional_delay_from_now operator()(const observer<std::span<const std::byte>, Strategy>& obs, const std::unique_ptr<const rpp::utils::mapped_file>& file, size_t& offset, size_t file_size, size_t chunk_size) const
+        {
+            try
+            {
+                {
+                    // region is unmapped right after emission, so observer can't keep span after on_next
+                    const auto region = file->map(offset, std::min(chunk_size, file_size - offset));
+                    offset += region.size();
+                    obs.on_next(std::span<const std::byte>{region.bytes()});
+                }
+
+                if (offset < file_size)
+                    return schedulers::delay_from_now{}; // re-schedule this
+
+                obs.on_completed();
+            }
+            catch (...)
+            {
+                obs.on_error(std::current_exception());
+            }
+            return std::nullopt;
+        }
+    };
+
+    template<schedulers::constraint::scheduler TScheduler>
+    struct from_mapped_file_strategy
+    {
+    public:
+        using value_type                   = std::span<const std::byte>;
+        using optimal_disposables_strategy = rpp::details::observables::fixed_disposables_strategy<0>;
+
+        std::filesystem::path            path;
+        size_t                           chunk_size;
+        RPP_NO_UNIQUE_ADDRESS TScheduler scheduler;
+
+        template<constraint::observer_strategy<value_type> Strategy>
+        void subscribe(observer<value_type, Strategy>&& obs) const
+        {
+            std::unique_ptr<const rpp::utils::mapped_file> file{};
+            size_t                                         file_size{};
+            try
+            {
+                file      = std::make_unique<const rpp::utils::mapped_file>(path, rpp::utils::mapped_file::mode::Read);
+                file_size = file->size();
+            }
+            catch (...)
+            {
+                obs.on_error(std::current_exception());
+                return;
+            }
+
+            if (file_size == 0)
+            {
+                obs.on_completed();
+                return;
+            }
+
+            const auto worker = scheduler.create_worker();
+            worker.schedule(from_mapped_file_schedulable{}, std::move(obs), std::move(file), size_t{}, size_t{file_size}, size_t{chunk_size});
+        }
+    };
+} // namespace rpp::details
+
+namespace rpp::source
+{
+    /**
+     * @brief Creates observable that emits content of file by chunks directly from memory mapping of this file.
+     *
+     * @marble from_mapped_file
+       {
+           operator "from_mapped_file(\"file of 10 bytes\", 4)": +-[4 bytes]-[4 bytes]-[2 bytes]-|
+       }
+     *
+     * @details Each subscription opens file on its own and maps only one chunk at a time, so files bigger than available memory or address space can be processed. Last chunk can be smaller than `chunk_size`. Any error during opening/mapping of file is emitted as `std::system_error` via on_error.
+     * @warning Emitted span points to mapped memory and valid only during `on_next` call. Use operators like `rpp::operators::map` to convert it to owning value if it is needed after that (e.g. before `observe_on` or `buffer`).
+     *
+     * @par Performance notes:
+     * - no any copies of file content: chunks are read directly from page cache
+     * - one map/unmap per chunk, so `chunk_size` should be big enough (and better multiple of page size)
+     *
+     * @param path is path to file to read
+     * @param chunk_size is maximum size of emitted chunk in bytes
+     * @param scheduler is scheduler used for scheduling of submissions: next chunk will be submitted to scheduler when previous one is executed
+     *
+     * @note `#include <rpp/sources/from_mapped_file.hpp>`
+     *
+     * @ingroup creational_operators
+     * @see https://reactivex.io/documentation/operators/from.html
+     */
+    template<schedulers::constraint::scheduler TScheduler /* = rpp::schedulers::defaults::iteration_scheduler*/>
+    auto from_mapped_file(std::filesystem::path path, size_t chunk_size, const TScheduler& scheduler /* = TScheduler{}*/)
+    {
+        using strategy = details::from_mapped_file_strategy<TScheduler>;
+        return observable<std::span<const std::byte>, strategy>{std::move(path), std::max(chunk_size, size_t{1}), scheduler};
+    }
+} // namespace rpp::source
@@ -20,6 +20,9 @@
 #include <rpp/utils/utils.hpp>
 
 #include <exception>
+#include <filesystem>
+#include <memory>
+#include <ranges>
 
 namespace rpp::constraint
 {
@@ -40,7 +43,22 @@ namespace rpp::source
     auto create(OnSubscribe&& on_subscribe);
 
     template<constraint::memory_model MemoryModel = memory_model::use_stack, constraint::iterable Iterable, schedulers::constraint::scheduler TScheduler = rpp::schedulers::defaults::iteration_scheduler>
-    auto from_iterable(Iterable&& iterable, const TScheduler& scheduler = TScheduler{});
+    auto from_iterable(Iterable&& iterable, const TScheduler& scheduler = TScheduler{}, size_t batch_size = 1);
+
+    template<std::ranges::contiguous_range Range, schedulers::constraint::scheduler TScheduler = rpp::schedulers::defaults::iteration_scheduler>
+        requires (std::ranges::borrowed_range<Range> && std::ranges::sized_range<Range>)
+    auto from_span(Range&& range, const TScheduler& scheduler = TScheduler{}, size_t batch_size = 1);
+
+    template<std::ranges::contiguous_range Range, schedulers::constraint::scheduler TScheduler = rpp::schedulers::defaults::iteration_scheduler>
+        requires std::ranges::sized_range<Range>
+    auto from_span(std::shared_ptr<Range> owner, const TScheduler& scheduler = TScheduler{}, size_t batch_size = 1);
+
+    template<std::ranges::viewable_range Range, schedulers::constraint::scheduler TScheduler = rpp::schedulers::defaults::iteration_scheduler>
+        requires std::copyable<std::views::all_t<Range>>
+    auto from_range(Range&& range, const TScheduler& scheduler = TScheduler{}, size_t batch_size = 1);
+
+    template<schedulers::constraint::scheduler TScheduler = rpp::schedulers::defaults::iteration_scheduler>
+    auto from_mapped_file(std::filesystem::path path, size_t chunk_size, const TScheduler& scheduler = TScheduler{});
 
     template<constraint::memory_model MemoryModel = memory_model::use_stack, typename T, typename... Ts>
         requires (constraint::decayed_same_as<T, Ts> && ...)
@@ -18,5 +18,8 @@
  */
 
 #include <rpp/subjects/behavior_subject.hpp>
+#include <rpp/subjects/buffered_subject.hpp>
+#include <rpp/subjects/fanout_subject.hpp>
 #include <rpp/subjects/publish_subject.hpp>
 #include <rpp/subjects/replay_subject.hpp>
+#include <rpp/subjects/spilling_replay_subject.hpp>
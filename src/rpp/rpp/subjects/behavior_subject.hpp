@@ -17,6 +17,7 @@
 #include <rpp/subjects/details/subject_on_subscribe.hpp>
 #include <rpp/subjects/details/subject_state.hpp>
 
+#include <type_traits>
 #include <utility>
 
 namespace rpp::subjects::details
@@ -26,6 +27,9 @@ namespace rpp::subjects::details
     {
         class behavior_state final : public subject_state<Type, Serialized>
         {
+            // trivially copyable values are published via seqlock, so readers never block writers
+            using value_storage = std::conditional_t<std::is_trivially_copyable_v<Type>, rpp::utils::seqlock_value<Type>, rpp::utils::value_with_mutex<Type>>;
+
         public:
             behavior_state(const Type& v)
                 : m_value{v}
@@ -36,10 +40,24 @@ namespace rpp::subjects::details
             {
             }
 
-            rpp::utils::pointer_under_lock<Type> get_value() { return rpp::utils::pointer_under_lock<Type>{m_value}; }
+            Type get_value()
+            {
+                if constexpr (std::is_trivially_copyable_v<Type>)
+                    return m_value.load();
+                else
+                    return *rpp::utils::pointer_under_lock<Type>{m_value};
+            }
+
+            void set_value(const Type& v)
+            {
+                if constexpr (std::is_trivially_copyable_v<Type>)
+                    m_value.store(v);
+                else
+                    *rpp::utils::pointer_under_lock<Type>{m_value} = v;
+            }
 
         private:
-            rpp::utils::value_with_mutex<Type> m_value{};
+            value_storage m_value;
         };
 
         struct observer_strategy
@@ -54,10 +72,16 @@ namespace rpp::subjects::details
 
             void on_next(const Type& v) const
             {
-                *state->get_value() = v;
+                state->set_value(v);
                 state->on_next(v);
             }
 
+            void on_next(Type&& v) const
+            {
+                state->set_value(v);
+                state->on_next(std::move(v));
+            }
+
             void on_error(const std::exception_ptr& err) const { state->on_error(err); }
 
             void on_completed() const { state->on_completed(); }
@@ -87,8 +111,7 @@ namespace rpp::subjects::details
                 const auto locked = state.lock();
                 if (!locked->is_disposed())
                 {
-                    auto v = *locked->get_value();
-                    observer.on_next(std::move(v));
+                    observer.on_next(locked->get_value());
                 }
                 locked->on_subscribe(std::forward<TObs>(observer));
             });
@@ -101,7 +124,7 @@ namespace rpp::subjects::details
 
         Type get_value() const
         {
-            return *m_state.lock()->get_value();
+            return m_state.lock()->get_value();
         }
 
 
@@ -115,6 +138,9 @@ namespace rpp::subjects
     /**
      * @brief Same as rpp::subjects::publish_subject but keeps last value (or default) and emits it to newly subscribed observer
      *
+     * @par Performance notes
+     * Trivially copyable values are published via seqlock: `get_value()` and new subscriptions never block `on_next` (readers just retry in case of concurrent update). Other values are guarded by mutex.
+     *
      * @tparam Type value provided by this subject
      *
      * @ingroup subjects
@@ -0,0 +1,133 @@
+//                   ReactivePlusPlus library
+//
+//           Copyright Aleksey Loginov 2023 - present.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+//
+//  Project home: https://github.com/victimsnino/ReactivePlusPlus
+
+#pragma once
+
+#include <rpp/operators/fwd.hpp>
+#include <rpp/schedulers/fwd.hpp>
+#include <rpp/subjects/fwd.hpp>
+
+#include <rpp/operators/on_backpressure_buffer.hpp>
+#include <rpp/operators/tap.hpp>
+#include <rpp/sources/defer.hpp>
+#include <rpp/subjects/publish_subject.hpp>
+
+#include <atomic>
+#include <memory>
+
+namespace rpp::subjects
+{
+    /**
+     * @brief Lag metrics of subscriber of rpp::subjects::buffered_subject. Can be read from any thread at any time.
+     */
+    struct subscriber_lag
+    {
+        std::atomic<size_t> received{};
+        std::atomic<size_t> delivered{};
+        std::atomic<size_t> dropped{};
+
+        /**
+         * @brief Amount of values received from the subject, but not delivered to the subscriber yet.
+         */
+        size_t pending() const
+        {
+            const auto delivered_and_dropped = delivered.load(std::memory_order::relaxed) + dropped.load(std::memory_order::relaxed);
+            const auto received_count        = received.load(std::memory_order::relaxed);
+            return received_count > delivered_and_dropped ? received_count - delivered_and_dropped : 0;
+        }
+    };
+
+    /**
+     * @brief Same as rpp::subjects::publish_subject, but each subscriber obtains values via its own bounded queue and worker of provided scheduler, so slow subscriber can't stall producer and other subscribers.
+     *
+     * @details When queue of subscriber is full, its overflow policy is applied:
+     * - `backpressure_overflow::DropNewest` - new value is dropped for this subscriber
+     * - `backpressure_overflow::DropOldest` - the oldest queued value is dropped (conflation: subscriber obtains the latest values)
+     * - `backpressure_overflow::Error` - subscriber is disconnected from the subject and obtains `rpp::utils::buffer_overflow` error
+     *
+     * @details Each subscriber uses capacity and overflow policy provided to constructor, but they can be overridden per subscriber via `get_observable(capacity, overflow)`. Lag of subscriber can be tracked via `get_observable(capacity, overflow, lag)`.
+     * Actually, it is `publish_subject` with `on_backpressure_buffer` operator applied to each subscriber.
+     *
+     * @warning `backpressure_overflow::Block` policy makes producer to wait for the slowest subscriber, so it breaks isolation.
+     *
+     * @param scheduler scheduler used to create worker delivering values to each subscriber
+     * @param capacity maximum amount of values waiting for each subscriber
+     * @param overflow policy applied when queue of subscriber is full (optional)
+     *
+     * @tparam Type value provided by this subject
+     * @tparam Scheduler type of scheduler
+     *
+     * @ingroup subjects
+     * @see https://reactivex.io/documentation/subject.html
+     */
+    template<rpp::constraint::decayed_type Type, rpp::schedulers::constraint::scheduler Scheduler>
+    class buffered_subject final
+    {
+    public:
+        buffered_subject(const Scheduler& scheduler, size_t capacity, rpp::operators::backpressure_overflow overflow = rpp::operators::backpressure_overflow::DropNewest)
+            : m_scheduler{scheduler}
+            , m_capacity{capacity}
+            , m_overflow{overflow}
+        {
+        }
+
+        auto get_observer() const
+        {
+            return m_subject.get_observer();
+        }
+
+        auto get_observable() const
+        {
+            return get_observable(m_capacity, m_overflow);
+        }
+
+        auto get_observable(size_t capacity, rpp::operators::backpressure_overflow overflow) const
+        {
+            return m_subject.get_observable() | rpp::operators::on_backpressure_buffer(capacity, m_scheduler, overflow);
+        }
+
+        /**
+         * @brief Same as `get_observable(capacity, overflow)`, but updates provided lag metrics. Metrics are accumulated over all subscriptions to returned observable.
+         * @details Values discarded without delivery on error (queue cleared by `backpressure_overflow::Error` policy or by error from the subject) are counted as dropped, so `pending()` doesn't include them.
+         */
+        auto get_observable(size_t capacity, rpp::operators::backpressure_overflow overflow, std::shared_ptr<subscriber_lag> lag) const
+        {
+            return rpp::source::defer([subject = m_subject, scheduler = m_scheduler, capacity, overflow, lag = std::move(lag)] {
+                // values received but not delivered or dropped by this subscription
+                auto pending = std::make_shared<std::atomic<size_t>>();
+                return subject.get_observable()
+                     | rpp::operators::tap([lag, pending](const Type&) {
+                           pending->fetch_add(1, std::memory_order::relaxed);
+                           lag->received.fetch_add(1, std::memory_order::relaxed);
+                       })
+                     | rpp::operators::on_backpressure_buffer(capacity, scheduler, overflow, [lag, pending](size_t) {
+                           pending->fetch_sub(1, std::memory_order::relaxed);
+                           lag->dropped.fetch_add(1, std::memory_order::relaxed);
+                       })
+                     | rpp::operators::tap([lag, pending](const Type&) {
+                                               pending->fetch_sub(1, std::memory_order::relaxed);
+                                               lag->delivered.fetch_add(1, std::memory_order::relaxed);
+                                           },
+                                           [lag, pending](const std::exception_ptr&) { lag->dropped.fetch_add(pending->exchange(0, std::memory_order::relaxed), std::memory_order::relaxed); },
+                                           [] {});
+            });
+        }
+
+        rpp::disposable_wrapper get_disposable() const
+        {
+            return m_subject.get_disposable();
+        }
+
+    private:
+        publish_subject<Type>                 m_subject{};
+        RPP_NO_UNIQUE_ADDRESS Scheduler       m_scheduler;
+        size_t                                m_capacity;
+        rpp::operators::backpressure_overflow m_overflow;
+    };
+} // namespace rpp::subjects
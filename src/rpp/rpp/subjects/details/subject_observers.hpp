@@ -0,0 +1,210 @@
+//                   ReactivePlusPlus library
+//
+//           Copyright Aleksey Loginov 2022 - present.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+//
+//  Project home: https://github.com/victimsnino/ReactivePlusPlus
+
+#pragma once
+
+#include <rpp/observers/dynamic_observer.hpp>
+#include <rpp/utils/constraints.hpp>
+#include <rpp/utils/utils.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace rpp::subjects::details
+{
+    /**
+     * @brief List of subject's observers optimized for emissions: readers iterate over contiguous immutable snapshot without any locks.
+     *
+     * @details Snapshot is published via atomic pointer (RCU-like): modifications create new snapshot (or append into free capacity of current one, which is invisible for readers till size is updated), while previous snapshots are retired and reclaimed via `rpp::utils::epoch_reclaimer` as soon as no reader can access them.
+     * Unsubscribed observers are not removed immediately, but marked with current generation and skipped by readers started after it, till amount of them reaches amount of alive observers, so both subscribe and unsubscribe are amortized O(1).
+     * Readers started before removal still see such an observer, as if they iterate over snapshot taken at the beginning.
+     *
+     * @warning Modifications (`add`, `remove`, `extract`) should be externally synchronized, readers (`for_each`) can be invoked concurrently from any thread.
+     */
+    template<rpp::constraint::decayed_type Type>
+    class subject_observers
+    {
+    public:
+        using observer = std::shared_ptr<rpp::details::observers::observer_vtable<Type>>;
+
+        /**
+         * @brief Removal mark owned by each subscribed observer
+         */
+        struct removal_mark
+        {
+            std::atomic<size_t> generation{std::numeric_limits<size_t>::max()};
+        };
+
+        subject_observers() = default;
+
+        subject_observers(const subject_observers&) = delete;
+        subject_observers(subject_observers&&)      = delete;
+
+        ~subject_observers() noexcept
+        {
+            delete m_snapshot.load(std::memory_order::relaxed);
+        }
+
+        void add(observer obs, const removal_mark* mark)
+        {
+            auto* current = m_snapshot.load(std::memory_order::relaxed);
+            if (current && current->size.load(std::memory_order::relaxed) < current->capacity)
+            {
+                const auto size        = current->size.load(std::memory_order::relaxed);
+                current->entries[size] = entry{std::move(obs), mark};
+                // entry becomes visible to readers only after size update
+                current->size.store(size + 1, std::memory_order::release);
+                return;
+            }
+
+            auto new_snapshot = rebuild(current, 1);
+            new_snapshot->entries[new_snapshot->size.load(std::memory_order::relaxed)] = entry{std::move(obs), mark};
+            new_snapshot->size.fetch_add(1, std::memory_order::relaxed);
+            publish(new_snapshot.release());
+        }
+
+        void remove(removal_mark& mark)
+        {
+            const auto* current = m_snapshot.load(std::memory_order::relaxed);
+            if (!current)
+                return;
+
+            // mark should be visible to any reader which sees new generation
+            const auto generation = m_generation.load(std::memory_order::relaxed) + 1;
+            mark.generation.store(generation, std::memory_order::relaxed);
+            m_generation.store(generation, std::memory_order::release);
+
+            if (++m_removed_count * 2 >= current->size.load(std::memory_order::relaxed))
+                publish(rebuild(current, 0).release());
+        }
+
+        /**
+         * @brief Extract all alive observers and leave list empty
+         */
+        std::vector<observer> extract()
+        {
+            std::vector<observer> result{};
+            if (const auto* current = m_snapshot.load(std::memory_order::relaxed))
+            {
+                const auto size = current->size.load(std::memory_order::relaxed);
+                result.reserve(size);
+                for (size_t i = 0; i < size; ++i)
+                {
+                    if (!current->entries[i].is_removed())
+                        result.push_back(current->entries[i].obs);
+                }
+            }
+            publish(nullptr);
+            return result;
+        }
+
+        template<typename Fn>
+        void for_each(const Fn& fn) const noexcept
+        {
+            for_each(fn, fn);
+        }
+
+        /**
+         * @brief Same as `for_each(fn)`, but the last observer is passed to `last_fn` instead (for example, to move value into it).
+         */
+        template<typename Fn, typename LastFn>
+        void for_each(const Fn& fn, const LastFn& last_fn) const noexcept
+        {
+            const typename rpp::utils::epoch_reclaimer<snapshot>::read_guard guard{m_reclaimer};
+            if (const auto* current = m_snapshot.load(std::memory_order::seq_cst))
+            {
+                const auto generation = m_generation.load(std::memory_order::acquire);
+                const auto size       = current->size.load(std::memory_order::acquire);
+
+                // observer is invoked only when next alive one is found, so the last one is known
+                const rpp::details::observers::observer_vtable<Type>* previous{};
+                for (size_t i = 0; i < size; ++i)
+                {
+                    const auto& e = current->entries[i];
+                    if (e.mark->generation.load(std::memory_order::relaxed) > generation)
+                    {
+                        if (previous)
+                            fn(*previous);
+                        previous = e.obs.get();
+                    }
+                }
+                if (previous)
+                    last_fn(*previous);
+            }
+        }
+
+        /**
+         * @brief Amount of retired snapshots which are not reclaimed yet
+         */
+        size_t retired_count() const { return m_reclaimer.retired_count(); }
+
+    private:
+        struct entry
+        {
+            bool is_removed() const { return mark->generation.load(std::memory_order::relaxed) != std::numeric_limits<size_t>::max(); }
+
+            observer            obs{};
+            const removal_mark* mark{};
+        };
+
+        struct snapshot
+        {
+            explicit snapshot(size_t capacity)
+                : entries{std::make_unique<entry[]>(capacity)}
+                , capacity{capacity}
+            {
+            }
+
+            std::unique_ptr<entry[]> entries;
+            const size_t             capacity;
+            std::atomic<size_t>      size{};
+        };
+
+        std::unique_ptr<snapshot> rebuild(const snapshot* current, size_t extra)
+        {
+            size_t alive{};
+            if (current)
+            {
+                const auto size = current->size.load(std::memory_order::relaxed);
+                alive           = static_cast<size_t>(std::count_if(current->entries.get(), current->entries.get() + size, [](const entry& e) { return !e.is_removed(); }));
+            }
+
+            auto new_snapshot = std::make_unique<snapshot>(std::max(size_t{4}, (alive + extra) * 2));
+            if (current)
+            {
+                const auto size = current->size.load(std::memory_order::relaxed);
+                size_t     index{};
+                for (size_t i = 0; i < size; ++i)
+                {
+                    if (!current->entries[i].is_removed())
+                        new_snapshot->entries[index++] = current->entries[i];
+                }
+                new_snapshot->size.store(index, std::memory_order::relaxed);
+            }
+            m_removed_count = 0;
+            return new_snapshot;
+        }
+
+        void publish(snapshot* new_snapshot)
+        {
+            // any reader started after exchange sees only new snapshot
+            if (auto* old = m_snapshot.exchange(new_snapshot, std::memory_order::seq_cst))
+                m_reclaimer.retire(std::unique_ptr<snapshot>{old});
+        }
+
+    private:
+        std::atomic<snapshot*>                m_snapshot{};
+        std::atomic<size_t>                   m_generation{};
+        rpp::utils::epoch_reclaimer<snapshot> m_reclaimer{};
+        size_t                                m_removed_count{};
+    };
+} // namespace rpp::subjects::details
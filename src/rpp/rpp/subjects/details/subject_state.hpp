@@ -15,12 +15,13 @@
 #include <rpp/disposables/composite_disposable.hpp>
 #include <rpp/disposables/disposable_wrapper.hpp>
 #include <rpp/observers/dynamic_observer.hpp>
+#include <rpp/subjects/details/subject_observers.hpp>
 #include <rpp/utils/constraints.hpp>
 #include <rpp/utils/functors.hpp>
+#include <rpp/utils/emitter_loop.hpp>
 #include <rpp/utils/utils.hpp>
 
-#include <algorithm>
-#include <list>
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <variant>
@@ -50,6 +51,8 @@ namespace rpp::subjects::details
             {
             }
 
+            const typename subject_observers<Type>::removal_mark* get_removal_mark() const { return &m_removal_mark; }
+
         private:
             void base_dispose_impl(interface_disposable::Mode) noexcept override
             {
@@ -57,19 +60,23 @@ namespace rpp::subjects::details
                 {
                     std::unique_lock lock{shared->m_mutex};
                     process_state_unsafe(shared->m_state,
-                                         [&](const shared_observers& observers) {
-                                             shared->m_state = cleanup_observers(observers, this);
+                                         [&](active) {
+                                             shared->m_observers.remove(m_removal_mark);
                                          });
                 }
             }
 
-            std::weak_ptr<subject_state> m_state{};
+            std::weak_ptr<subject_state>                   m_state{};
+            typename subject_observers<Type>::removal_mark m_removal_mark{};
         };
 
-        using observer         = std::shared_ptr<rpp::details::observers::observer_vtable<Type>>;
-        using observers        = std::list<observer>;
-        using shared_observers = std::shared_ptr<observers>;
-        using state_t          = std::variant<shared_observers, std::exception_ptr, completed, disposed>;
+        struct active
+        {
+        };
+
+        using observer  = typename subject_observers<Type>::observer;
+        using observers = std::vector<observer>;
+        using state_t   = std::variant<active, std::exception_ptr, completed, disposed>;
 
     public:
         using optimal_disposables_strategy = rpp::details::observables::fixed_disposables_strategy<1>;
@@ -82,19 +89,10 @@ namespace rpp::subjects::details
             std::unique_lock lock{m_mutex};
             process_state_unsafe(
                 m_state,
-                [&](const shared_observers& observers) {
+                [&](active) {
                     auto d   = disposable_wrapper_impl<disposable_with_observer<std::decay_t<TObs>>>::make(std::forward<TObs>(observer), this->wrapper_from_this().lock());
                     auto ptr = d.lock();
-                    if (!observers)
-                    {
-                        auto new_observers = std::make_shared<subject_state::observers>();
-                        new_observers->emplace_back(ptr);
-                        m_state = std::move(new_observers);
-                    }
-                    else
-                    {
-                        observers->emplace_back(ptr);
-                    }
+                    m_observers.add(ptr, ptr->get_removal_mark());
 
                     lock.unlock();
                     ptr->set_upstream(d.as_weak());
@@ -111,42 +109,34 @@ namespace rpp::subjects::details
 
         void on_next(const Type& v)
         {
-            std::unique_lock observers_lock{m_mutex};
-            process_state_unsafe(m_state, [&](shared_observers observers) {
-                if (!observers)
-                    return;
-
-                auto       itr  = observers->cbegin();
-                const auto size = observers->size();
-
-                observers_lock.unlock();
+            if constexpr (Serialized)
+                serialize(std::in_place_index<0>, v);
+            else
+                emit_next(v);
+        }
 
-                std::lock_guard lock{m_serialized_mutex};
-                for (size_t i = 0; i < size; ++i)
-                {
-                    (*(itr++))->on_next(v);
-                }
-            });
+        void on_next(Type&& v)
+        {
+            if constexpr (Serialized)
+                serialize(std::in_place_index<0>, std::move(v));
+            else
+                emit_next(std::move(v));
         }
 
         void on_error(const std::exception_ptr& err)
         {
-            {
-                std::lock_guard lock{m_serialized_mutex};
-                if (const auto observers = exchange_observers_under_lock_if_there(err))
-                    rpp::utils::for_each(*observers, [&](const observer& obs) { obs->on_error(err); });
-            }
-            dispose();
+            if constexpr (Serialized)
+                serialize(std::in_place_index<1>, err);
+            else
+                emit_error(err);
         }
 
         void on_completed()
         {
-            {
-                std::lock_guard lock{m_serialized_mutex};
-                if (const auto observers = exchange_observers_under_lock_if_there(completed{}))
-                    rpp::utils::for_each(*observers, [](const observer& obs) { obs->on_completed(); });
-            }
-            dispose();
+            if constexpr (Serialized)
+                serialize(std::in_place_index<2>, completed{});
+            else
+                emit_completed();
         }
 
     private:
@@ -155,38 +145,62 @@ namespace rpp::subjects::details
             exchange_observers_under_lock_if_there(disposed{});
         }
 
-        static shared_observers cleanup_observers(const shared_observers& current_subs, const rpp::details::observers::observer_vtable<Type>* to_delete)
+        void emit_next(const Type& v) const
         {
-            auto subs = std::make_shared<observers>();
-            if (current_subs)
-            {
-                std::copy_if(current_subs->cbegin(),
-                             current_subs->cend(),
-                             std::back_inserter(*subs),
-                             [&to_delete](const observer& obs) {
-                                 return to_delete != obs.get();
-                             });
-            }
-            return subs;
+            m_observers.for_each([&](const auto& obs) { obs.on_next(v); });
+        }
+
+        // all observers except of last one obtain value by const reference, so it can be moved into the last one
+        void emit_next(Type&& v) const
+        {
+            m_observers.for_each([&](const auto& obs) { obs.on_next(v); },
+                                 [&](const auto& obs) { obs.on_next(std::move(v)); });
+        }
+
+        void emit_error(const std::exception_ptr& err)
+        {
+            for (const auto& obs : exchange_observers_under_lock_if_there(err))
+                obs->on_error(err);
+            dispose();
         }
 
+        void emit_completed()
+        {
+            for (const auto& obs : exchange_observers_under_lock_if_there(completed{}))
+                obs->on_completed();
+            dispose();
+        }
+
+        // emissions from different threads are serialized via emitter loop, so producers never block each other
+        template<size_t I, typename... Args>
+        void serialize(std::in_place_index_t<I> index, Args&&... args)
+        {
+            m_serialized.emit([this](auto emission_index, auto&&... vals) { emit(emission_index, std::forward<decltype(vals)>(vals)...); }, index, std::forward<Args>(args)...);
+        }
+
+        void emit(std::in_place_index_t<0>, const Type& v) const { emit_next(v); }
+        void emit(std::in_place_index_t<0>, Type&& v) const { emit_next(std::move(v)); }
+        void emit(std::in_place_index_t<1>, const std::exception_ptr& err) { emit_error(err); }
+        void emit(std::in_place_index_t<2>, completed) { emit_completed(); }
+
         static auto process_state_unsafe(const state_t& state, const auto&... actions)
         {
             return std::visit(rpp::utils::overloaded{actions..., rpp::utils::empty_function_any_t{}}, state);
         }
 
-        shared_observers exchange_observers_under_lock_if_there(state_t&& new_val)
+        observers exchange_observers_under_lock_if_there(state_t&& new_val)
         {
             std::lock_guard lock{m_mutex};
 
-            return process_state_unsafe(m_state, [&](shared_observers observers) {
+            return process_state_unsafe(m_state, [&](active) {
                 m_state = std::move(new_val);
-                return observers; }, [](auto) { return shared_observers{}; });
+                return m_observers.extract(); }, [](auto) { return observers{}; });
         }
 
     private:
-        state_t                                                                                  m_state;
-        std::mutex                                                                               m_mutex{};
-        RPP_NO_UNIQUE_ADDRESS std::conditional_t<Serialized, std::mutex, rpp::utils::none_mutex> m_serialized_mutex{};
+        state_t                                                                                                                        m_state;
+        subject_observers<Type>                                                                                                        m_observers{};
+        std::mutex                                                                                                                     m_mutex{};
+        RPP_NO_UNIQUE_ADDRESS std::conditional_t<Serialized, rpp::utils::emitter_loop<Type, std::exception_ptr, completed>, rpp::utils::none> m_serialized{};
     };
 } // namespace rpp::subjects::details
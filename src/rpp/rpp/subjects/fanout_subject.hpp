@@ -0,0 +1,244 @@
+//                   ReactivePlusPlus library
+//
+//           Copyright Aleksey Loginov 2023 - present.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+//
+//  Project home: https://github.com/victimsnino/ReactivePlusPlus
+
+#pragma once
+
+#include <rpp/schedulers/fwd.hpp>
+#include <rpp/subjects/fwd.hpp>
+
+#include <rpp/disposables/composite_disposable.hpp>
+#include <rpp/disposables/disposable_wrapper.hpp>
+#include <rpp/observers/observer.hpp>
+#include <rpp/subjects/details/subject_on_subscribe.hpp>
+#include <rpp/subjects/details/subject_state.hpp>
+#include <rpp/utils/mpsc_queue.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <variant>
+#include <vector>
+
+namespace rpp::subjects::details
+{
+    /**
+     * @brief Part of subscribers of fanout subject with own worker. Emissions are queued and delivered to subscribers of shard by its worker one-by-one.
+     */
+    template<rpp::constraint::decayed_type Type, typename Worker>
+    struct fanout_shard
+    {
+        // emission is allocated once and shared between all shards
+        using emission = std::variant<std::shared_ptr<const Type>, std::exception_ptr, completed>;
+
+        explicit fanout_shard(Worker&& worker)
+            : worker{std::move(worker)}
+        {
+        }
+
+        disposable_wrapper_impl<subject_state<Type, false>> state = disposable_wrapper_impl<subject_state<Type, false>>::make();
+        RPP_NO_UNIQUE_ADDRESS Worker                        worker;
+        rpp::utils::mpsc_queue<emission>                    queue{};
+        std::atomic<size_t>                                 wip{};
+    };
+
+    template<rpp::constraint::decayed_type Type, typename Worker>
+    struct fanout_shard_handler
+    {
+        std::shared_ptr<fanout_shard<Type, Worker>> shard{};
+
+        bool is_disposed() const { return shard->state.is_disposed(); }
+
+        void on_error(const std::exception_ptr& err) const { shard->state.lock()->on_error(err); }
+    };
+
+    template<rpp::constraint::decayed_type Type, rpp::schedulers::constraint::scheduler Scheduler>
+    class fanout_state final : public composite_disposable
+    {
+        using worker_t  = rpp::schedulers::utils::get_worker_t<Scheduler>;
+        using shard_t   = fanout_shard<Type, worker_t>;
+        using handler_t = fanout_shard_handler<Type, worker_t>;
+
+    public:
+        fanout_state(const Scheduler& scheduler, size_t shards_count)
+        {
+            shards_count = std::max(size_t{1}, shards_count);
+            m_shards.reserve(shards_count);
+            for (size_t i = 0; i < shards_count; ++i)
+                m_shards.push_back(std::make_shared<shard_t>(scheduler.create_worker()));
+        }
+
+        template<rpp::constraint::observer_of_type<Type> TObs>
+        void on_subscribe(TObs&& observer)
+        {
+            m_shards[m_next_shard.fetch_add(1, std::memory_order::relaxed) % m_shards.size()]->state.lock()->on_subscribe(std::forward<TObs>(observer));
+        }
+
+        template<typename T>
+        void on_next(T&& v) const
+        {
+            const auto value = std::make_shared<const Type>(std::forward<T>(v));
+            for (const auto& shard : m_shards)
+                push(shard, value);
+        }
+
+        void on_error(const std::exception_ptr& err)
+        {
+            terminate(err);
+        }
+
+        void on_completed()
+        {
+            terminate(completed{});
+        }
+
+    private:
+        void composite_dispose_impl(interface_disposable::Mode) noexcept override
+        {
+            // after terminal event each shard disposes its state by itself as soon as it delivers queued emissions
+            if (m_terminated.load(std::memory_order::acquire))
+                return;
+
+            for (const auto& shard : m_shards)
+                shard->state.dispose();
+        }
+
+        template<typename T>
+        void terminate(const T& emission)
+        {
+            for (const auto& shard : m_shards)
+                push(shard, emission);
+
+            // upstream is released immediately, but queued emissions are still delivered
+            m_terminated.store(true, std::memory_order::release);
+            dispose();
+        }
+
+        template<typename T>
+        static void push(const std::shared_ptr<shard_t>& shard, T&& emission)
+        {
+            shard->queue.emplace(std::forward<T>(emission));
+            // worker is scheduled only by emission which found shard idle, all other emissions are drained by it
+            if (shard->wip.fetch_add(1, std::memory_order::acq_rel) == 0)
+                shard->worker.schedule([](const handler_t& handler) { return drain(*handler.shard); }, handler_t{shard});
+        }
+
+        static rpp::schedulers::optional_delay_from_now drain(shard_t& shard)
+        {
+            const auto state  = shard.state.lock();
+            size_t     missed = shard.wip.load(std::memory_order::acquire);
+            while (missed != 0)
+            {
+                for (size_t i = 0; i < missed; ++i)
+                {
+                    // each `wip` increment follows push into queue, but producer could be still in the middle of it
+                    auto emission = shard.queue.pop();
+                    while (!emission)
+                    {
+                        std::this_thread::yield();
+                        emission = shard.queue.pop();
+                    }
+
+                    std::visit(rpp::utils::overloaded{[&](const std::shared_ptr<const Type>& v) { state->on_next(*v); },
+                                                      [&](const std::exception_ptr& err) {
+                                                          state->on_error(err);
+                                                          shard.state.dispose();
+                                                      },
+                                                      [&](completed) {
+                                                          state->on_completed();
+                                                          shard.state.dispose();
+                                                      }},
+                               emission.value());
+                }
+                missed = shard.wip.fetch_sub(missed, std::memory_order::acq_rel) - missed;
+            }
+            return std::nullopt;
+        }
+
+    private:
+        std::vector<std::shared_ptr<shard_t>> m_shards{};
+        std::atomic<size_t>                   m_next_shard{};
+        std::atomic_bool                      m_terminated{};
+    };
+} // namespace rpp::subjects::details
+
+namespace rpp::subjects
+{
+    /**
+     * @brief Same as rpp::subjects::publish_subject, but delivers emissions to subscribers in parallel: subscribers are distributed between `shards_count` shards (round-robin) and each shard delivers emissions to its subscribers on its own worker of provided scheduler.
+     *
+     * @details Producer only enqueues emission to each shard and never waits for subscribers, so it is suitable for big amount of subscribers (e.g. push model with subscriber per client) and schedulers with multiple threads like rpp::schedulers::thread_pool.
+     * Each subscriber obtains emissions in the same order as they were emitted, but different subscribers obtain them at different time. Subscriber can obtain emissions emitted right before its subscription, if its shard didn't deliver them yet.
+     * on_next/on_error/on_completed can be called from any thread: each shard delivers emissions serially. Same order for all subscribers is guaranteed only for single producer (or externally serialized producers): emissions from concurrent producers are enqueued to each shard separately, so subscribers of different shards can obtain them in different order.
+     * Terminal event disposes subject immediately (upstream is released), while each shard disposes its state right after delivering terminal event to its subscribers.
+     *
+     * @par Performance notes
+     * - Each emission is allocated once and shared between shards
+     * - Worker of shard is scheduled only when shard is idle, all emissions enqueued meanwhile are delivered by the same schedulable
+     *
+     * @param scheduler scheduler used to create worker per shard
+     * @param shards_count amount of shards (optional)
+     *
+     * @tparam Type value provided by this subject
+     * @tparam Scheduler type of scheduler
+     *
+     * @ingroup subjects
+     * @see https://reactivex.io/documentation/subject.html
+     */
+    template<rpp::constraint::decayed_type Type, rpp::schedulers::constraint::scheduler Scheduler>
+    class fanout_subject final
+    {
+        using state_t = details::fanout_state<Type, Scheduler>;
+
+        struct observer_strategy
+        {
+            static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::None;
+
+            std::shared_ptr<state_t> state{};
+
+            void set_upstream(const disposable_wrapper& d) const noexcept { state->add(d); }
+
+            bool is_disposed() const noexcept { return state->is_disposed(); }
+
+            void on_next(const Type& v) const { state->on_next(v); }
+
+            void on_next(Type&& v) const { state->on_next(std::move(v)); }
+
+            void on_error(const std::exception_ptr& err) const { state->on_error(err); }
+
+            void on_completed() const { state->on_completed(); }
+        };
+
+    public:
+        using optimal_disposables_strategy = typename details::subject_state<Type, false>::optimal_disposables_strategy;
+
+        explicit fanout_subject(const Scheduler& scheduler, size_t shards_count = std::thread::hardware_concurrency())
+            : m_state{disposable_wrapper_impl<state_t>::make(scheduler, shards_count)}
+        {
+        }
+
+        auto get_observer() const
+        {
+            return rpp::observer<Type, observer_strategy>{m_state.lock()};
+        }
+
+        auto get_observable() const
+        {
+            return details::create_subject_on_subscribe_observable<Type, optimal_disposables_strategy>([state = m_state]<rpp::constraint::observer_of_type<Type> TObs>(TObs&& observer) { state.lock()->on_subscribe(std::forward<TObs>(observer)); });
+        }
+
+        rpp::disposable_wrapper get_disposable() const
+        {
+            return m_state;
+        }
+
+    private:
+        disposable_wrapper_impl<state_t> m_state;
+    };
+} // namespace rpp::subjects
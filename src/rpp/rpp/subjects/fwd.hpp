@@ -12,10 +12,26 @@
 #include <rpp/disposables/fwd.hpp>
 #include <rpp/observables/fwd.hpp>
 #include <rpp/observers/fwd.hpp>
+#include <rpp/schedulers/fwd.hpp>
 
 #include <rpp/utils/constraints.hpp>
 #include <rpp/utils/utils.hpp>
 
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace rpp::constraint
+{
+    template<typename S, typename Type>
+    concept replay_serializer = requires(const S& serializer, const Type& value, std::vector<std::byte>& out, std::span<const std::byte> bytes) {
+        serializer.serialize(value, out);
+        {
+            serializer.deserialize(bytes)
+        } -> std::same_as<Type>;
+    };
+} // namespace rpp::constraint
+
 namespace rpp::subjects
 {
     template<rpp::constraint::decayed_type Type>
@@ -39,6 +55,19 @@ namespace rpp::subjects
     class serialized_behavior_subject;
 
 
+    template<rpp::constraint::decayed_type Type, rpp::constraint::replay_serializer<Type> Serializer>
+    class spilling_replay_subject;
+
+    template<rpp::constraint::decayed_type Type, rpp::constraint::replay_serializer<Type> Serializer>
+    class serialized_spilling_replay_subject;
+
+
+    template<rpp::constraint::decayed_type Type, rpp::schedulers::constraint::scheduler Scheduler>
+    class fanout_subject;
+
+    template<rpp::constraint::decayed_type Type, rpp::schedulers::constraint::scheduler Scheduler>
+    class buffered_subject;
+
 } // namespace rpp::subjects
 
 namespace rpp::constraint
@@ -33,6 +33,8 @@ namespace rpp::subjects::details
 
             void on_next(const Type& v) const { state->on_next(v); }
 
+            void on_next(Type&& v) const { state->on_next(std::move(v)); }
+
             void on_error(const std::exception_ptr& err) const { state->on_error(err); }
 
             void on_completed() const { state->on_completed(); }
@@ -69,6 +71,9 @@ namespace rpp::subjects
      *
      * @details Each observer obtains only values which emitted after corresponding subscribe. on_error/on_completer/unsubscribe cached and provided to new observers if any
      *
+     * @par Performance notes
+     * Value passed to observer's `on_next` by rvalue is passed to all subscribers except of the last one by const reference and moved into the last one, so subject with single subscriber doesn't copy values at all.
+     *
      * @warning this subject is not synchronized/serialized! It means, that expected to call callbacks of observer in the serialized way to follow observable contract: "Observables must issue notifications to observers serially (not in parallel).". If you are not sure or need extra serialization, please, use serialized_publish_subject.
      *
      * @tparam Type value provided by this subject
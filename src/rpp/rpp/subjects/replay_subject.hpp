@@ -17,7 +17,13 @@
 #include <rpp/subjects/details/subject_on_subscribe.hpp>
 #include <rpp/subjects/details/subject_state.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
 #include <deque>
+#include <memory>
+#include <new>
+#include <vector>
 #include <utility>
 
 namespace rpp::subjects::details
@@ -27,21 +33,6 @@ namespace rpp::subjects::details
     {
         struct replay_state final : public subject_state<Type, Serialized>
         {
-            replay_state(size_t limit = std::numeric_limits<size_t>::max(), rpp::schedulers::duration duration_limit = std::numeric_limits<rpp::schedulers::duration>::max())
-                : m_limit(limit)
-                , m_duration_limit(duration_limit)
-            {
-            }
-
-            void add_value(const Type& v)
-            {
-                std::unique_lock lock{m_values_mutex};
-                while (m_values.size() >= m_limit)
-                    m_values.pop_front();
-
-                m_values.emplace_back(v, deduce_timepoint());
-            }
-
             struct value_with_time
             {
                 value_with_time(const Type& v, rpp::schedulers::clock_type::time_point timepoint)
@@ -54,12 +45,112 @@ namespace rpp::subjects::details
                 rpp::schedulers::clock_type::time_point timepoint;
             };
 
+            /**
+             * @brief Fixed-capacity append-only storage of values: values are constructed in place and published via atomic size, so values visible to some snapshot are never modified or moved and segment is shared between buffer and snapshots.
+             *
+             * @details Evicted values are destroyed only together with whole segment, because snapshots taken before eviction still can read them. As a result, up to segment's capacity of evicted values is kept alive.
+             */
+            class segment
+            {
+            public:
+                explicit segment(size_t capacity)
+                    : m_slots{std::make_unique<slot[]>(capacity)}
+                    , m_capacity{capacity}
+                {
+                }
+
+                segment(const segment&) = delete;
+                segment(segment&&)      = delete;
 
-            std::deque<value_with_time> get_actual_values()
+                ~segment() noexcept
+                {
+                    for (size_t i = 0; i < m_size.load(std::memory_order::relaxed); ++i)
+                        std::destroy_at(get(i));
+                }
+
+                bool is_full() const { return m_size.load(std::memory_order::relaxed) == m_capacity; }
+
+                void emplace_back(const Type& v, rpp::schedulers::clock_type::time_point timepoint)
+                {
+                    const auto size = m_size.load(std::memory_order::relaxed);
+                    std::construct_at(reinterpret_cast<value_with_time*>(m_slots[size].data), v, timepoint);
+                    // value becomes visible to readers only after size update
+                    m_size.store(size + 1, std::memory_order::release);
+                }
+
+                size_t size() const { return m_size.load(std::memory_order::acquire); }
+
+                const value_with_time& operator[](size_t index) const { return *get(index); }
+
+            private:
+                value_with_time* get(size_t index) const { return std::launder(reinterpret_cast<value_with_time*>(m_slots[index].data)); }
+
+                struct slot
+                {
+                    alignas(value_with_time) std::byte data[sizeof(value_with_time)];
+                };
+
+                std::unique_ptr<slot[]> m_slots;
+                const size_t            m_capacity;
+                std::atomic<size_t>     m_size{};
+            };
+
+            class values_snapshot
+            {
+            public:
+                values_snapshot(std::vector<std::shared_ptr<const segment>> segments, size_t begin, size_t count)
+                    : m_segments{std::move(segments)}
+                    , m_begin{begin}
+                    , m_count{count}
+                {
+                }
+
+                template<typename Fn>
+                void for_each(const Fn& fn) const
+                {
+                    // producer could append new values concurrently, so only values published before snapshot are read
+                    size_t index = m_begin;
+                    size_t count = m_count;
+                    for (const auto& s : m_segments)
+                    {
+                        for (const size_t size = s->size(); index < size && count != 0; ++index, --count)
+                            fn((*s)[index].value);
+                        index = 0;
+                    }
+                }
+
+            private:
+                std::vector<std::shared_ptr<const segment>> m_segments;
+                size_t                                      m_begin;
+                size_t                                      m_count;
+            };
+
+            replay_state(size_t limit = std::numeric_limits<size_t>::max(), rpp::schedulers::duration duration_limit = std::numeric_limits<rpp::schedulers::duration>::max())
+                : m_limit(limit)
+                , m_duration_limit(duration_limit)
+                , m_segment_capacity{std::clamp<size_t>(limit, 16, 1024)}
+            {
+            }
+
+            void add_value(const Type& v)
+            {
+                std::unique_lock lock{m_values_mutex};
+                const auto       timepoint = deduce_timepoint();
+                if (m_segments.empty() || m_segments.back()->is_full())
+                    m_segments.push_back(std::make_shared<segment>(m_segment_capacity));
+
+                m_segments.back()->emplace_back(v, timepoint);
+                ++m_count;
+
+                while (m_count > m_limit)
+                    pop_front();
+            }
+
+            values_snapshot get_actual_values()
             {
                 std::unique_lock lock{m_values_mutex};
                 deduce_timepoint();
-                return m_values;
+                return values_snapshot{{m_segments.cbegin(), m_segments.cend()}, m_begin, m_count};
             }
 
         private:
@@ -69,17 +160,30 @@ namespace rpp::subjects::details
                     return rpp::schedulers::clock_type::time_point{};
 
                 auto now = rpp::schedulers::clock_type::now();
-                while (!m_values.empty() && (now - m_values.front().timepoint > m_duration_limit))
-                    m_values.pop_front();
+                while (m_count != 0 && (now - (*m_segments.front())[m_begin].timepoint > m_duration_limit))
+                    pop_front();
                 return now;
             }
 
+            void pop_front()
+            {
+                --m_count;
+                if (++m_begin == m_segment_capacity)
+                {
+                    m_segments.pop_front();
+                    m_begin = 0;
+                }
+            }
+
         private:
-            std::mutex                  m_values_mutex{};
-            std::deque<value_with_time> m_values{};
+            std::mutex                           m_values_mutex{};
+            std::deque<std::shared_ptr<segment>> m_segments{};
+            size_t                               m_begin{};
+            size_t                               m_count{};
 
             const size_t                    m_limit;
             const rpp::schedulers::duration m_duration_limit;
+            const size_t                    m_segment_capacity;
         };
 
         struct observer_strategy
@@ -98,6 +202,12 @@ namespace rpp::subjects::details
                 state->on_next(v);
             }
 
+            void on_next(Type&& v) const
+            {
+                state->add_value(v);
+                state->on_next(std::move(v));
+            }
+
             void on_error(const std::exception_ptr& err) const { state->on_error(err); }
 
             void on_completed() const { state->on_completed(); }
@@ -130,8 +240,7 @@ namespace rpp::subjects::details
         {
             return create_subject_on_subscribe_observable<Type, optimal_disposables_strategy>([state = m_state]<rpp::constraint::observer_of_type<Type> TObs>(TObs&& observer) {
                 const auto locked = state.lock();
-                for (auto&& value : locked->get_actual_values())
-                    observer.on_next(std::move(value.value));
+                locked->get_actual_values().for_each([&observer](const Type& value) { observer.on_next(value); });
                 locked->on_subscribe(std::forward<TObs>(observer));
             });
         }
@@ -167,7 +276,7 @@ namespace rpp::subjects
     };
 
     /**
-     * @brief Same as rpp::subjects::replay_subject but on_next/on_error/on_completed calls are serialized via mutex.
+     * @brief Same as rpp::subjects::replay_subject but on_next/on_error/on_completed calls are serialized.
      * @details When you are using ordinary rpp::subjects::replay_subject, then you must take care not to call its on_next method (or its other on methods) in async way.
      *
      * @ingroup subjects
@@ -0,0 +1,333 @@
+//                   ReactivePlusPlus library
+//
+//           Copyright Aleksey Loginov 2023 - present.
+//  Distributed under the Boost Software License, Version 1.0.
+//     (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+//
+//  Project home: https://github.com/victimsnino/ReactivePlusPlus
+
+#pragma once
+
+#include <rpp/subjects/fwd.hpp>
+
+#include <rpp/disposables/disposable_wrapper.hpp>
+#include <rpp/observers/observer.hpp>
+#include <rpp/subjects/details/subject_on_subscribe.hpp>
+#include <rpp/subjects/details/subject_state.hpp>
+#include <rpp/utils/mapped_file.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace rpp::subjects::details
+{
+    /**
+     * @brief Append-only file used to store spilled values. File is removed as soon as subject and all replays from it are destroyed.
+     */
+    class spill_file
+    {
+    public:
+        explicit spill_file(std::filesystem::path path)
+            : m_path{std::move(path)}
+            , m_file{m_path, rpp::utils::mapped_file::mode::ReadWrite}
+        {
+        }
+
+        spill_file(const spill_file&) = delete;
+        spill_file(spill_file&&)      = delete;
+
+        ~spill_file() noexcept
+        {
+            std::error_code ec{};
+            std::filesystem::remove(m_path, ec);
+        }
+
+        /**
+         * @brief Extend file with new chunk of at least `min_size` bytes and map it into memory for writing.
+         *
+         * @return offset of new chunk in file and mapped chunk itself
+         */
+        std::pair<size_t, rpp::utils::mapped_region> append_chunk(size_t min_size)
+        {
+            const auto granularity = rpp::utils::mapped_file::granularity();
+            const auto size        = (min_size + granularity - 1) / granularity * granularity;
+
+            m_file.resize(m_size + size);
+            auto region = m_file.map(m_size, size);
+            return {std::exchange(m_size, m_size + size), std::move(region)};
+        }
+
+        /**
+         * @brief Map already written part of file into memory for reading.
+         */
+        rpp::utils::mapped_region map(size_t offset, size_t size) const { return m_file.map(offset, size); }
+
+    private:
+        std::filesystem::path   m_path;
+        rpp::utils::mapped_file m_file;
+        size_t                  m_size{};
+    };
+
+    template<rpp::constraint::decayed_type Type, typename Serializer, bool Serialized>
+    class spilling_replay_subject_base
+    {
+        // each record is stored as size of serialized value followed by serialized bytes
+        using record_size_t = uint64_t;
+
+        // chunks are append-only: bytes before captured used size are never modified, so they can be read without any locks
+        struct chunk
+        {
+            size_t offset;
+            size_t used;
+        };
+
+        struct spilling_replay_state final : public subject_state<Type, Serialized>
+        {
+            class values_snapshot
+            {
+            public:
+                values_snapshot(std::shared_ptr<const spill_file> file, std::vector<chunk> chunks, std::vector<Type> hot_values, const Serializer& serializer)
+                    : m_file{std::move(file)}
+                    , m_chunks{std::move(chunks)}
+                    , m_hot_values{std::move(hot_values)}
+                    , m_serializer{serializer}
+                {
+                }
+
+                template<typename Fn>
+                void for_each(const Fn& fn) const
+                {
+                    for (const auto& c : m_chunks)
+                    {
+                        // chunk is mapped only while it is replayed
+                        const auto  region = m_file->map(c.offset, c.used);
+                        const auto* data   = region.data();
+                        for (size_t offset = 0; offset < c.used;)
+                        {
+                            record_size_t size{};
+                            std::memcpy(&size, data + offset, sizeof(size));
+                            offset += sizeof(size);
+
+                            fn(m_serializer.deserialize(std::span<const std::byte>{data + offset, static_cast<size_t>(size)}));
+                            offset += static_cast<size_t>(size);
+                        }
+                    }
+
+                    for (const auto& v : m_hot_values)
+                        fn(v);
+                }
+
+            private:
+                // order matters: file is removed only after the last snapshot is destroyed
+                std::shared_ptr<const spill_file> m_file;
+                std::vector<chunk>                m_chunks;
+                std::vector<Type>                 m_hot_values;
+                const Serializer&                 m_serializer;
+            };
+
+            spilling_replay_state(std::filesystem::path path, size_t hot_limit, Serializer serializer, size_t chunk_size)
+                : m_file{std::make_shared<spill_file>(std::move(path))}
+                , m_serializer{std::move(serializer)}
+                , m_hot_limit{hot_limit}
+                , m_chunk_size{std::max<size_t>(1, chunk_size)}
+            {
+            }
+
+            /**
+             * @brief Add value to replay buffer. In case of any failure of spilling (serializer or file I/O) buffer is left untouched and exception is propagated, so subject emits it as on_error.
+             */
+            void add_value(const Type& v)
+            {
+                std::unique_lock lock{m_values_mutex};
+                m_hot.push_back(v);
+                if (m_hot.size() > m_hot_limit)
+                {
+                    try
+                    {
+                        spill(m_hot.front());
+                    }
+                    catch (...)
+                    {
+                        m_hot.pop_back();
+                        throw;
+                    }
+                    m_hot.pop_front();
+                }
+            }
+
+            values_snapshot get_actual_values()
+            {
+                std::vector<chunk> chunks{};
+                std::vector<Type>  hot{};
+                {
+                    std::unique_lock lock{m_values_mutex};
+                    chunks = m_chunks;
+                    hot.assign(m_hot.cbegin(), m_hot.cend());
+                }
+                return values_snapshot{m_file, std::move(chunks), std::move(hot), m_serializer};
+            }
+
+        private:
+            void spill(const Type& v)
+            {
+                m_buffer.clear();
+                m_serializer.serialize(v, m_buffer);
+
+                const record_size_t size        = m_buffer.size();
+                const size_t        record_size = sizeof(size) + m_buffer.size();
+                // only chunk being written is kept mapped, filled ones are mapped by replays on demand
+                if (m_chunks.empty() || m_chunks.back().used + record_size > m_write_region.size())
+                {
+                    auto [offset, region] = m_file->append_chunk(std::max(m_chunk_size, record_size));
+                    m_chunks.push_back(chunk{offset, 0});
+                    m_write_region = std::move(region);
+                }
+
+                auto& used = m_chunks.back().used;
+                auto* data = m_write_region.data() + used;
+                std::memcpy(data, &size, sizeof(size));
+                if (!m_buffer.empty())
+                    std::memcpy(data + sizeof(size), m_buffer.data(), m_buffer.size());
+                used += record_size;
+            }
+
+        private:
+            std::mutex                  m_values_mutex{};
+            std::shared_ptr<spill_file> m_file;
+            // order matters: region should be unmapped before file is removed
+            rpp::utils::mapped_region m_write_region{};
+            std::vector<chunk>        m_chunks{};
+            std::deque<Type>          m_hot{};
+            std::vector<std::byte>    m_buffer{};
+
+            const Serializer m_serializer;
+            const size_t     m_hot_limit;
+            const size_t     m_chunk_size;
+        };
+
+        struct observer_strategy
+        {
+            static constexpr auto preferred_disposables_mode = rpp::details::observers::disposables_mode::None;
+
+            std::shared_ptr<spilling_replay_state> state;
+
+            void set_upstream(const disposable_wrapper& d) const noexcept { state->add(d); }
+
+            bool is_disposed() const noexcept { return state->is_disposed(); }
+
+            void on_next(const Type& v) const
+            {
+                state->add_value(v);
+                state->on_next(v);
+            }
+
+            void on_next(Type&& v) const
+            {
+                state->add_value(v);
+                state->on_next(std::move(v));
+            }
+
+            void on_error(const std::exception_ptr& err) const { state->on_error(err); }
+
+            void on_completed() const { state->on_completed(); }
+        };
+
+    public:
+        using optimal_disposables_strategy = typename details::subject_state<Type, Serialized>::optimal_disposables_strategy;
+
+        /**
+         * @param path path to file used to spill values to. File is created (or truncated) immediately and removed when subject and all replays from it are destroyed.
+         * @param hot_count maximum amount of latest values kept in memory, older ones are spilled to file.
+         * @param serializer serializer used to convert values to bytes and back.
+         * @param chunk_size size of file's part mapped into memory at once: chunk being written by subject and chunk being replayed by each new observer. Rounded up to page size.
+         */
+        spilling_replay_subject_base(std::filesystem::path path, size_t hot_count, Serializer serializer = {}, size_t chunk_size = 16 * 1024 * 1024)
+            : m_state{disposable_wrapper_impl<spilling_replay_state>::make(std::move(path), hot_count, std::move(serializer), chunk_size)}
+        {
+        }
+
+        auto get_observer() const
+        {
+            return rpp::observer<Type, observer_strategy>{m_state.lock()};
+        }
+
+        auto get_observable() const
+        {
+            return create_subject_on_subscribe_observable<Type, optimal_disposables_strategy>([state = m_state]<rpp::constraint::observer_of_type<Type> TObs>(TObs&& observer) {
+                const auto locked = state.lock();
+                try
+                {
+                    locked->get_actual_values().for_each([&observer](auto&& value) { observer.on_next(std::forward<decltype(value)>(value)); });
+                }
+                catch (...)
+                {
+                    // spilled values can't be mapped or deserialized
+                    observer.on_error(std::current_exception());
+                    return;
+                }
+                locked->on_subscribe(std::forward<TObs>(observer));
+            });
+        }
+
+        rpp::disposable_wrapper get_disposable() const
+        {
+            return m_state;
+        }
+
+    private:
+        disposable_wrapper_impl<spilling_replay_state> m_state;
+    };
+} // namespace rpp::subjects::details
+
+namespace rpp::subjects
+{
+    /**
+     * @brief Same as rpp::subjects::replay_subject with unbounded buffer, but keeps in memory only `hot_count` latest values while older ones are serialized and spilled to memory-mapped append-only file.
+     *
+     * @details New observers obtain spilled values directly from mapped file (deserialized one-by-one), so replay of huge history doesn't materialize it in memory. Subject keeps mapped only chunk being written, while replay maps chunks one-by-one on demand. File is never shrunk and lives till subject and all in-progress replays are destroyed.
+     * @details Failure of spilling (serializer or file I/O) is emitted as on_error of subject, while values replayed to new observers stay consistent with values emitted to existing ones.
+     *
+     * @par Serializer
+     * Serializer should provide `void serialize(const Type&, std::vector<std::byte>& out) const` appending bytes of value to `out` and `Type deserialize(std::span<const std::byte>) const`. Serialization happens on thread emitting value, while deserialization happens on thread subscribing to subject, so both of them should be thread-safe.
+     *
+     * @param path path to file used to spill values to
+     * @param hot_count maximum amount of latest values kept in memory
+     * @param serializer serializer used to convert values to bytes and back
+     * @param chunk_size size of file's part mapped into memory at once (optional)
+     *
+     * @tparam Type value provided by this subject
+     * @tparam Serializer type of serializer
+     *
+     * @ingroup subjects
+     * @see https://reactivex.io/documentation/subject.html
+     */
+    template<rpp::constraint::decayed_type Type, rpp::constraint::replay_serializer<Type> Serializer>
+    class spilling_replay_subject final : public details::spilling_replay_subject_base<Type, Serializer, false>
+    {
+    public:
+        using details::spilling_replay_subject_base<Type, Serializer, false>::spilling_replay_subject_base;
+    };
+
+    /**
+     * @brief Same as rpp::subjects::spilling_replay_subject but on_next/on_error/on_completed calls are serialized.
+     * @details When you are using ordinary rpp::subjects::spilling_replay_subject, then you must take care not to call its on_next method (or its other on methods) in async way.
+     *
+     * @ingroup subjects
+     * @see https://reactivex.io/documentation/subject.html
+     */
+    template<rpp::constraint::decayed_type Type, rpp::constraint::replay_serializer<Type> Serializer>
+    class serialized_spilling_replay_subject final : public details::spilling_replay_subject_base<Type, Serializer, true>
+    {
+    public:
+        using details::spilling_replay_subject_base<Type, Serializer, true>::spilling_replay_subject_base;
+    };
+} // namespace rpp::subjects
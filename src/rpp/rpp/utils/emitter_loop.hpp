@@ -0,0 +1,81 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <rpp/utils/mpsc_queue.hpp>
+
+#include <atomic>
+#include <thread>
+#include <utility>
+#include <variant>
+
+namespace rpp::utils
+{
+    /**
+     * @brief Emitter-loop serialization of emissions from multiple threads: thread which finds loop idle passes its own emission to handler directly and then drains emissions queued by other threads meanwhile. Other threads just enqueue emission and never block.
+     *
+     * @details Handler is invoked as `handler(std::in_place_index<I>, values...)` for emission passed directly and as `handler(std::in_place_index<I>, std::move(value))` for queued emission, where `I` is index of emission's type in `Ts`. Handler is never invoked concurrently.
+     */
+    template<typename... Ts>
+    class emitter_loop
+    {
+        using emission = std::variant<Ts...>;
+
+    public:
+        template<size_t I, typename Handler, typename... Args>
+        void emit(const Handler& handler, std::in_place_index_t<I> index, Args&&... args)
+        {
+            size_t expected{};
+            if (m_wip.compare_exchange_strong(expected, 1, std::memory_order::acq_rel))
+            {
+                handler(index, std::forward<Args>(args)...);
+                drain(handler, m_wip.fetch_sub(1, std::memory_order::acq_rel) - 1);
+                return;
+            }
+
+            m_queue.emplace(index, std::forward<Args>(args)...);
+            if (m_wip.fetch_add(1, std::memory_order::acq_rel) == 0)
+                drain(handler, 1);
+        }
+
+    private:
+        template<typename Handler>
+        void drain(const Handler& handler, size_t missed)
+        {
+            while (missed != 0)
+            {
+                for (size_t i = 0; i < missed; ++i)
+                {
+                    // each `wip` increment follows push into queue, but producer could be still in the middle of it
+                    auto value = m_queue.pop();
+                    while (!value)
+                    {
+                        std::this_thread::yield();
+                        value = m_queue.pop();
+                    }
+
+                    dispatch(handler, std::move(value).value(), std::index_sequence_for<Ts...>{});
+                }
+                missed = m_wip.fetch_sub(missed, std::memory_order::acq_rel) - missed;
+            }
+        }
+
+        template<typename Handler, size_t... I>
+        static void dispatch(const Handler& handler, emission&& value, std::index_sequence<I...>)
+        {
+            (void)((value.index() == I && (handler(std::in_place_index<I>, std::move(std::get<I>(value))), true)) || ...);
+        }
+
+    private:
+        mpsc_queue<emission> m_queue{};
+        std::atomic<size_t>  m_wip{};
+    };
+} // namespace rpp::utils
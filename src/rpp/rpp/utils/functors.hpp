@@ -11,6 +11,7 @@
 #pragma once
 
 #include <exception>
+#include <functional>
 #include <tuple>
 
 namespace rpp::utils
@@ -78,6 +79,15 @@ namespace rpp::utils
         }
     };
 
+    struct hash
+    {
+        template<typename T>
+        size_t operator()(const T& v) const
+        {
+            return std::hash<T>{}(v);
+        }
+    };
+
     struct pack_to_tuple
     {
         auto operator()(auto&&... vals) const { return std::make_tuple(std::forward<decltype(vals)>(vals)...); }
@@ -0,0 +1,255 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <system_error>
+#include <utility>
+
+#if defined(_WIN32)
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#        define RPP_UNDEF_NOMINMAX
+#    endif
+#    ifndef WIN32_LEAN_AND_MEAN
+#        define WIN32_LEAN_AND_MEAN
+#        define RPP_UNDEF_WIN32_LEAN_AND_MEAN
+#    endif
+#    include <windows.h>
+#    ifdef RPP_UNDEF_NOMINMAX
+#        undef NOMINMAX
+#        undef RPP_UNDEF_NOMINMAX
+#    endif
+#    ifdef RPP_UNDEF_WIN32_LEAN_AND_MEAN
+#        undef WIN32_LEAN_AND_MEAN
+#        undef RPP_UNDEF_WIN32_LEAN_AND_MEAN
+#    endif
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+namespace rpp::utils
+{
+    /**
+     * @brief Mapped into memory part of file. Keeps mapping alive till destruction, even if original rpp::utils::mapped_file is already closed.
+     */
+    class mapped_region
+    {
+    public:
+        mapped_region() = default;
+
+        mapped_region(void* base, size_t mapped_size, size_t offset_in_mapping, size_t size)
+            : m_base{base}
+            , m_mapped_size{mapped_size}
+            , m_offset{offset_in_mapping}
+            , m_size{size}
+        {
+        }
+
+        mapped_region(const mapped_region&) = delete;
+        mapped_region(mapped_region&& other) noexcept
+            : m_base{std::exchange(other.m_base, nullptr)}
+            , m_mapped_size{std::exchange(other.m_mapped_size, 0)}
+            , m_offset{std::exchange(other.m_offset, 0)}
+            , m_size{std::exchange(other.m_size, 0)}
+        {
+        }
+
+        mapped_region& operator=(const mapped_region&) = delete;
+        mapped_region& operator=(mapped_region&& other) noexcept
+        {
+            if (this != &other)
+            {
+                unmap();
+                m_base        = std::exchange(other.m_base, nullptr);
+                m_mapped_size = std::exchange(other.m_mapped_size, 0);
+                m_offset      = std::exchange(other.m_offset, 0);
+                m_size        = std::exchange(other.m_size, 0);
+            }
+            return *this;
+        }
+
+        ~mapped_region() noexcept { unmap(); }
+
+        std::byte* data() const { return static_cast<std::byte*>(m_base) + m_offset; }
+        size_t     size() const { return m_size; }
+
+        std::span<std::byte> bytes() const { return {data(), m_size}; }
+
+    private:
+        void unmap() noexcept
+        {
+            if (!m_base)
+                return;
+#if defined(_WIN32)
+            ::UnmapViewOfFile(m_base);
+#else
+            ::munmap(m_base, m_mapped_size);
+#endif
+            m_base = nullptr;
+        }
+
+    private:
+        void*  m_base{};
+        size_t m_mapped_size{};
+        size_t m_offset{};
+        size_t m_size{};
+    };
+
+    /**
+     * @brief Minimal cross-platform wrapper over file which can be mapped into memory by parts.
+     *
+     * @details `Read` mode opens existing file, `ReadWrite` mode creates new file or truncates existing one. Any error reported via `std::system_error`.
+     */
+    class mapped_file
+    {
+    public:
+        enum class mode : uint8_t
+        {
+            Read,
+            ReadWrite
+        };
+
+        mapped_file(const std::filesystem::path& path, mode m)
+            : m_mode{m}
+        {
+#if defined(_WIN32)
+            const DWORD access = m == mode::Read ? GENERIC_READ : (GENERIC_READ | GENERIC_WRITE);
+            m_handle           = ::CreateFileW(path.c_str(), access, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, m == mode::Read ? OPEN_EXISTING : CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (m_handle == INVALID_HANDLE_VALUE)
+                throw_last_error("unable to open file");
+#else
+            m_handle = ::open(path.c_str(), m == mode::Read ? O_RDONLY : (O_RDWR | O_CREAT | O_TRUNC), 0644);
+            if (m_handle < 0)
+                throw_last_error("unable to open file");
+#endif
+        }
+
+        mapped_file(const mapped_file&) = delete;
+        mapped_file(mapped_file&&)      = delete;
+
+        ~mapped_file() noexcept
+        {
+#if defined(_WIN32)
+            ::CloseHandle(m_handle);
+#else
+            ::close(m_handle);
+#endif
+        }
+
+        size_t size() const
+        {
+#if defined(_WIN32)
+            LARGE_INTEGER size{};
+            if (!::GetFileSizeEx(m_handle, &size))
+                throw_last_error("unable to get file size");
+            return static_cast<size_t>(size.QuadPart);
+#else
+            struct stat st
+            {
+            };
+            if (::fstat(m_handle, &st) != 0)
+                throw_last_error("unable to get file size");
+            return static_cast<size_t>(st.st_size);
+#endif
+        }
+
+        /**
+         * @brief Change size of file opened in `ReadWrite` mode. New space is filled with zeroes.
+         */
+        void resize(size_t new_size)
+        {
+#if defined(_WIN32)
+            FILE_END_OF_FILE_INFO info{};
+            info.EndOfFile.QuadPart = static_cast<LONGLONG>(new_size);
+            if (!::SetFileInformationByHandle(m_handle, FileEndOfFileInfo, &info, sizeof(info)))
+                throw_last_error("unable to resize file");
+#else
+            if (::ftruncate(m_handle, static_cast<off_t>(new_size)) != 0)
+                throw_last_error("unable to resize file");
+#endif
+        }
+
+        /**
+         * @brief Map `[offset, offset + size)` part of file into memory. Offset has no any alignment requirements.
+         */
+        mapped_region map(size_t offset, size_t size) const
+        {
+            if (size == 0)
+                return {};
+
+            const size_t aligned_offset = offset - offset % granularity();
+            const size_t mapped_size    = size + (offset - aligned_offset);
+#if defined(_WIN32)
+            const HANDLE mapping = ::CreateFileMappingW(m_handle, nullptr, m_mode == mode::Read ? PAGE_READONLY : PAGE_READWRITE, 0, 0, nullptr);
+            if (!mapping)
+                throw_last_error("unable to map file");
+
+            void* base = ::MapViewOfFile(mapping, m_mode == mode::Read ? FILE_MAP_READ : FILE_MAP_WRITE, static_cast<DWORD>(static_cast<uint64_t>(aligned_offset) >> 32), static_cast<DWORD>(aligned_offset & 0xFFFFFFFFu), mapped_size);
+            if (!base)
+            {
+                const auto error = ::GetLastError();
+                ::CloseHandle(mapping);
+                throw std::system_error{static_cast<int>(error), std::system_category(), "unable to map file"};
+            }
+            // view keeps mapping object alive by itself
+            ::CloseHandle(mapping);
+#else
+            void* base = ::mmap(nullptr, mapped_size, m_mode == mode::Read ? PROT_READ : (PROT_READ | PROT_WRITE), MAP_SHARED, m_handle, static_cast<off_t>(aligned_offset));
+            if (base == MAP_FAILED)
+                throw_last_error("unable to map file");
+#endif
+            return mapped_region{base, mapped_size, offset - aligned_offset, size};
+        }
+
+        /**
+         * @brief Alignment of offsets which can be mapped without any extra bytes.
+         */
+        static size_t granularity()
+        {
+            static const size_t s_granularity = [] {
+#if defined(_WIN32)
+                SYSTEM_INFO info{};
+                ::GetSystemInfo(&info);
+                return static_cast<size_t>(info.dwAllocationGranularity);
+#else
+                return static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+#endif
+            }();
+            return s_granularity;
+        }
+
+    private:
+        [[noreturn]] static void throw_last_error(const char* what)
+        {
+#if defined(_WIN32)
+            throw std::system_error{static_cast<int>(::GetLastError()), std::system_category(), what};
+#else
+            throw std::system_error{errno, std::generic_category(), what};
+#endif
+        }
+
+    private:
+#if defined(_WIN32)
+        HANDLE m_handle{INVALID_HANDLE_VALUE};
+#else
+        int m_handle{-1};
+#endif
+        mode m_mode;
+    };
+} // namespace rpp::utils
@@ -0,0 +1,85 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <atomic>
+#include <optional>
+#include <utility>
+
+namespace rpp::utils
+{
+    /**
+     * @brief Unbounded multi-producer single-consumer queue (intrusive Vyukov's queue). `emplace` can be called from any thread and never blocks, `pop` should be called only by one thread at a time.
+     *
+     * @warning `pop` returns `std::nullopt` while the oldest pushed value is still in the middle of `emplace` even if some newer values are already pushed.
+     */
+    template<typename T>
+    class mpsc_queue
+    {
+        struct node
+        {
+            node() = default;
+
+            template<typename... Args>
+            explicit node(std::in_place_t, Args&&... args)
+                : value{std::in_place, std::forward<Args>(args)...}
+            {
+            }
+
+            std::atomic<node*> next{};
+            std::optional<T>   value{};
+        };
+
+    public:
+        mpsc_queue() = default;
+
+        mpsc_queue(const mpsc_queue&) = delete;
+        mpsc_queue(mpsc_queue&&)      = delete;
+
+        ~mpsc_queue() noexcept
+        {
+            while (m_tail)
+                destroy(std::exchange(m_tail, m_tail->next.load(std::memory_order::relaxed)));
+        }
+
+        template<typename... Args>
+        void emplace(Args&&... args)
+        {
+            auto* new_node = new node{std::in_place, std::forward<Args>(args)...};
+            auto* prev     = m_head.exchange(new_node, std::memory_order::acq_rel);
+            prev->next.store(new_node, std::memory_order::release);
+        }
+
+        std::optional<T> pop()
+        {
+            auto* next = m_tail->next.load(std::memory_order::acquire);
+            if (!next)
+                return std::nullopt;
+
+            // `next` becomes new stub node, so value is moved out of it
+            destroy(std::exchange(m_tail, next));
+            return std::exchange(next->value, std::nullopt);
+        }
+
+    private:
+        // initial stub node is embedded to avoid extra allocation for queue which is never used
+        void destroy(node* n) const
+        {
+            if (n != &m_stub)
+                delete n;
+        }
+
+    private:
+        node               m_stub{};
+        node*              m_tail = &m_stub;
+        std::atomic<node*> m_head{m_tail};
+    };
+} // namespace rpp::utils
@@ -0,0 +1,86 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace rpp::utils
+{
+    /**
+     * @brief FIFO queue over contiguous storage allocated once. Buffer with zero capacity has no limit and doubles its storage when full.
+     */
+    template<typename T>
+    class ring_buffer
+    {
+    public:
+        explicit ring_buffer(size_t capacity = 0)
+            : m_data(capacity)
+            , m_bounded{capacity != 0}
+        {
+        }
+
+        bool   empty() const { return m_size == 0; }
+        size_t size() const { return m_size; }
+        bool   full() const { return m_bounded && m_size == m_data.size(); }
+
+        T&       front() { return m_data[m_head].value(); }
+        const T& front() const { return m_data[m_head].value(); }
+
+        template<typename... Args>
+        void emplace_back(Args&&... args)
+        {
+            assert(!full());
+            if (m_size == m_data.size())
+                grow();
+
+            m_data[wrap(m_head + m_size)].emplace(std::forward<Args>(args)...);
+            ++m_size;
+        }
+
+        void pop_front()
+        {
+            assert(!empty());
+            m_data[m_head].reset();
+            m_head = wrap(m_head + 1);
+            --m_size;
+        }
+
+        void clear()
+        {
+            while (!empty())
+                pop_front();
+        }
+
+    private:
+        // index never exceeds doubled capacity, so conditional subtraction is enough instead of modulo
+        size_t wrap(size_t index) const { return index >= m_data.size() ? index - m_data.size() : index; }
+
+        void grow()
+        {
+            std::vector<std::optional<T>> data(std::max(m_data.size() * 2, size_t{16}));
+            for (size_t i = 0; i < m_size; ++i)
+                data[i] = std::move(m_data[wrap(m_head + i)]);
+
+            m_data = std::move(data);
+            m_head = 0;
+        }
+
+    private:
+        std::vector<std::optional<T>> m_data;
+        size_t                        m_head{};
+        size_t                        m_size{};
+        bool                          m_bounded;
+    };
+} // namespace rpp::utils
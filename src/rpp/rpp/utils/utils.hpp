@@ -15,8 +15,16 @@
 #include <rpp/utils/tuple.hpp>
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstring>
+#include <memory>
 #include <mutex>
+#include <optional>
+#include <thread>
 #include <variant>
+#include <vector>
 
 namespace rpp::utils
 {
@@ -313,6 +321,270 @@ namespace rpp::utils
     template<typename T>
     using pointer_under_lock = typename value_with_mutex<T>::pointer_under_lock;
 
+    /**
+     * @brief Value published via seqlock: readers never block writers (and each other) and just retry in case of concurrent write, writers are serialized between each other.
+     *
+     * @details Value is stored as array of atomic words, so concurrent read and write is not data race.
+     */
+    template<typename T>
+    class seqlock_value
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "seqlock_value can be used only with trivially copyable types");
+
+        using words = std::array<size_t, (sizeof(T) + sizeof(size_t) - 1) / sizeof(size_t)>;
+
+    public:
+        explicit seqlock_value(const T& v)
+        {
+            const auto w = to_words(v);
+            for (size_t i = 0; i < w.size(); ++i)
+                m_words[i].store(w[i], std::memory_order::relaxed);
+        }
+
+        T load() const noexcept
+        {
+            words w{};
+            while (true)
+            {
+                const auto seq = m_seq.load(std::memory_order::acquire);
+                if (seq % 2 == 0)
+                {
+                    for (size_t i = 0; i < w.size(); ++i)
+                        w[i] = m_words[i].load(std::memory_order::relaxed);
+
+                    std::atomic_thread_fence(std::memory_order::acquire);
+                    if (m_seq.load(std::memory_order::relaxed) == seq)
+                        return from_words(w);
+                }
+                std::this_thread::yield();
+            }
+        }
+
+        void store(const T& v)
+        {
+            const auto       w = to_words(v);
+            std::unique_lock lock{m_write_mutex};
+
+            const auto seq = m_seq.load(std::memory_order::relaxed);
+            m_seq.store(seq + 1, std::memory_order::relaxed);
+            std::atomic_thread_fence(std::memory_order::release);
+
+            for (size_t i = 0; i < w.size(); ++i)
+                m_words[i].store(w[i], std::memory_order::relaxed);
+
+            m_seq.store(seq + 2, std::memory_order::release);
+        }
+
+    private:
+        static words to_words(const T& v)
+        {
+            words w{};
+            std::memcpy(w.data(), &v, sizeof(T));
+            return w;
+        }
+
+        static T from_words(const words& w)
+        {
+            std::array<std::byte, sizeof(T)> bytes{};
+            std::memcpy(bytes.data(), w.data(), sizeof(T));
+            return std::bit_cast<T>(bytes);
+        }
+
+    private:
+        std::atomic<size_t>                             m_seq{};
+        std::array<std::atomic<size_t>, words{}.size()> m_words{};
+        std::mutex                                      m_write_mutex{};
+    };
+
+    /**
+     * @brief Epoch-based reclamation of objects replaced by writer while lock-free readers still can access them.
+     *
+     * @details Each reader is registered in counter of current epoch for the duration of `read_guard`. Retired objects are collected into list of current epoch, and epoch is flipped as soon as previous one has no readers: at this moment objects retired before the previous flip are unreachable and deleted.
+     * Reclamation is attempted by `retire` and by the last reader leaving an epoch, so retired objects are released even if some reader is always active. Objects are deleted outside of internal lock, so their destructors can use this reclaimer again.
+     */
+    template<typename T>
+    class epoch_reclaimer
+    {
+    public:
+        class read_guard
+        {
+        public:
+            explicit read_guard(const epoch_reclaimer& reclaimer)
+                : m_reclaimer{reclaimer}
+                , m_epoch{reclaimer.enter()}
+            {
+            }
+
+            read_guard(const read_guard&) = delete;
+            read_guard(read_guard&&)      = delete;
+
+            ~read_guard() noexcept { m_reclaimer.leave(m_epoch); }
+
+        private:
+            const epoch_reclaimer& m_reclaimer;
+            const size_t           m_epoch;
+        };
+
+        epoch_reclaimer() = default;
+
+        epoch_reclaimer(const epoch_reclaimer&) = delete;
+        epoch_reclaimer(epoch_reclaimer&&)      = delete;
+
+        /**
+         * @brief Delete object as soon as no reader can access it. Object should be already unreachable for new readers.
+         */
+        void retire(std::unique_ptr<T> ptr)
+        {
+            {
+                std::lock_guard lock{m_mutex};
+                try
+                {
+                    m_retired[1].push_back(std::move(ptr));
+                }
+                catch (...)
+                {
+                    // some reader still can access it, so leaking is the only safe option
+                    (void)ptr.release();
+                    throw;
+                }
+                m_has_retired.store(true, std::memory_order::seq_cst);
+            }
+            reclaim();
+        }
+
+        size_t retired_count() const
+        {
+            std::lock_guard lock{m_mutex};
+            return m_retired[0].size() + m_retired[1].size();
+        }
+
+    private:
+        size_t enter() const noexcept
+        {
+            // reader registered in stale epoch is safe too: it just blocks the next flip
+            const auto epoch = m_epoch.load(std::memory_order::seq_cst);
+            m_readers[epoch].fetch_add(1, std::memory_order::seq_cst);
+            return epoch;
+        }
+
+        void leave(size_t epoch) const noexcept
+        {
+            if (m_readers[epoch].fetch_sub(1, std::memory_order::seq_cst) == 1 && m_has_retired.load(std::memory_order::seq_cst))
+                reclaim();
+        }
+
+        void reclaim() const noexcept
+        {
+            // at most two flips are needed to release everything
+            std::array<std::vector<std::unique_ptr<T>>, 2> unreachable{};
+            {
+                std::lock_guard lock{m_mutex};
+                for (auto& objects : unreachable)
+                {
+                    const auto epoch = m_epoch.load(std::memory_order::seq_cst);
+                    if ((m_retired[0].empty() && m_retired[1].empty()) || m_readers[epoch ^ 1].load(std::memory_order::seq_cst) != 0)
+                        break;
+
+                    // readers of previous epoch are gone, so objects retired before the last flip can't be accessed anymore
+                    objects = std::exchange(m_retired[0], std::exchange(m_retired[1], {}));
+                    m_epoch.store(epoch ^ 1, std::memory_order::seq_cst);
+                }
+                m_has_retired.store(!m_retired[0].empty() || !m_retired[1].empty(), std::memory_order::seq_cst);
+            }
+        }
+
+    private:
+        mutable std::atomic<size_t>                            m_epoch{};
+        mutable std::array<std::atomic<size_t>, 2>             m_readers{};
+        mutable std::atomic_bool                               m_has_retired{};
+        mutable std::mutex                                     m_mutex{};
+        // [0] - retired before the last flip, [1] - retired in current epoch
+        mutable std::array<std::vector<std::unique_ptr<T>>, 2> m_retired{};
+    };
+
+    /**
+     * @brief Latest value (initially empty) published for readers which never block writer and each other: trivially copyable values are stored via seqlock, other values are published as immutable snapshots via atomic pointer (RCU-like).
+     *
+     * @details `load()` returns `std::optional<T>` or guard keeping snapshot alive correspondingly: both are contextually convertible to bool and dereferenceable. Replaced snapshots are reclaimed via `epoch_reclaimer` as soon as no reader can access them.
+     *
+     * @warning `store` should be externally synchronized, `load` can be invoked concurrently from any thread.
+     */
+    template<typename T>
+    class snapshot_value
+    {
+        static constexpr bool is_seqlock = std::is_trivially_copyable_v<std::optional<T>>;
+
+        struct shared_storage
+        {
+            std::atomic<const T*>    snapshot{};
+            epoch_reclaimer<const T> reclaimer{};
+        };
+
+        class snapshot_guard
+        {
+        public:
+            explicit snapshot_guard(const shared_storage& storage)
+                : m_guard{storage.reclaimer}
+                , m_value{storage.snapshot.load(std::memory_order::seq_cst)}
+            {
+            }
+
+            snapshot_guard(const snapshot_guard&) = delete;
+            snapshot_guard(snapshot_guard&&)      = delete;
+
+            explicit operator bool() const { return m_value != nullptr; }
+            const T& operator*() const { return *m_value; }
+
+        private:
+            typename epoch_reclaimer<const T>::read_guard m_guard;
+            const T*                                      m_value{};
+        };
+
+    public:
+        snapshot_value() = default;
+
+        snapshot_value(const snapshot_value&) = delete;
+        snapshot_value(snapshot_value&&)      = delete;
+
+        ~snapshot_value() noexcept
+        {
+            if constexpr (!is_seqlock)
+                delete m_storage.snapshot.load(std::memory_order::relaxed);
+        }
+
+        auto load() const
+        {
+            if constexpr (is_seqlock)
+                return m_storage.load();
+            else
+                return snapshot_guard{m_storage};
+        }
+
+        template<typename TT>
+        void store(TT&& v)
+        {
+            if constexpr (is_seqlock)
+                m_storage.store(std::optional<T>{std::forward<TT>(v)});
+            else
+            {
+                // any reader started after exchange sees only new snapshot
+                if (const auto* old = m_storage.snapshot.exchange(std::make_unique<const T>(std::forward<TT>(v)).release(), std::memory_order::seq_cst))
+                    m_storage.reclaimer.retire(std::unique_ptr<const T>{old});
+            }
+        }
+
+    private:
+        std::conditional_t<is_seqlock, seqlock_value<std::optional<T>>, shared_storage> m_storage{initial_storage()};
+
+        static auto initial_storage()
+        {
+            if constexpr (is_seqlock)
+                return std::optional<T>{};
+            else
+                return shared_storage{};
+        }
+    };
+
     namespace details
     {
         template<typename T, typename... Ts>
@@ -11,10 +11,13 @@
 #include <doctest/doctest.h>
 
 #include <rpp/observables/dynamic_observable.hpp>
+#include <rpp/observers/mock_observer.hpp>
 #include <rpp/operators/buffer.hpp>
 #include <rpp/operators/merge.hpp>
+#include <rpp/schedulers/test_scheduler.hpp>
 #include <rpp/sources/error.hpp>
 #include <rpp/sources/just.hpp>
+#include <rpp/subjects/publish_subject.hpp>
 
 #include "disposable_observable.hpp"
 #include "rpp_trompeloil.hpp"
@@ -121,3 +124,85 @@ TEST_CASE("buffer satisfies disposable contracts")
 {
     test_operator_with_disposable<int>(rpp::ops::buffer(1));
 }
+
+TEST_CASE("buffer_with_time bundles items by time")
+{
+    rpp::subjects::publish_subject<int> subj{};
+    rpp::schedulers::test_scheduler     scheduler{};
+    auto                                start  = rpp::schedulers::test_scheduler::s_current_time;
+    auto                                period = std::chrono::seconds{1};
+    auto                                mock   = mock_observer_strategy<std::vector<int>>{};
+
+    subj.get_observable() | rpp::ops::buffer_with_time(period, scheduler) | rpp::ops::subscribe(mock);
+    CHECK(scheduler.get_schedulings() == std::vector{start + period});
+
+    subj.get_observer().on_next(1);
+    subj.get_observer().on_next(2);
+    CHECK(mock.get_total_on_next_count() == 0);
+
+    SUBCASE("bundle emitted on timer tick")
+    {
+        scheduler.time_advance(period);
+        CHECK(mock.get_received_values() == std::vector<std::vector<int>>{{1, 2}});
+
+        SUBCASE("empty bundle is not emitted, timer keeps ticking")
+        {
+            scheduler.time_advance(period);
+            CHECK(mock.get_total_on_next_count() == 1);
+
+            subj.get_observer().on_next(3);
+            scheduler.time_advance(period);
+            CHECK(mock.get_received_values() == std::vector<std::vector<int>>{{1, 2}, {3}});
+            CHECK(scheduler.get_executions() == std::vector{start + period, start + 2 * period, start + 3 * period});
+        }
+    }
+
+    SUBCASE("remaining items emitted on completion")
+    {
+        subj.get_observer().on_completed();
+        CHECK(mock.get_received_values() == std::vector<std::vector<int>>{{1, 2}});
+        CHECK(mock.get_on_completed_count() == 1);
+
+        SUBCASE("timer stops after completion")
+        {
+            scheduler.time_advance(period);
+            CHECK(mock.get_total_on_next_count() == 1);
+            CHECK(scheduler.get_schedulings().size() == 1);
+        }
+    }
+
+    SUBCASE("error forwarded without bundle")
+    {
+        subj.get_observer().on_error({});
+        CHECK(mock.get_total_on_next_count() == 0);
+        CHECK(mock.get_on_error_count() == 1);
+    }
+}
+
+TEST_CASE("buffer_with_time_or_count emits bundle on whichever comes first")
+{
+    rpp::subjects::publish_subject<int> subj{};
+    rpp::schedulers::test_scheduler     scheduler{};
+    auto                                period = std::chrono::seconds{1};
+    auto                                mock   = mock_observer_strategy<std::vector<int>>{};
+
+    subj.get_observable() | rpp::ops::buffer_with_time_or_count(period, 2, scheduler) | rpp::ops::subscribe(mock);
+
+    for (int v : {1, 2, 3})
+        subj.get_observer().on_next(v);
+    CHECK(mock.get_received_values() == std::vector<std::vector<int>>{{1, 2}});
+
+    scheduler.time_advance(period);
+    CHECK(mock.get_received_values() == std::vector<std::vector<int>>{{1, 2}, {3}});
+
+    subj.get_observer().on_next(4);
+    subj.get_observer().on_next(5);
+    subj.get_observer().on_completed();
+    CHECK(mock.get_received_values() == std::vector<std::vector<int>>{{1, 2}, {3}, {4, 5}});
+    CHECK(mock.get_on_completed_count() == 1);
+}
+
+TEST_CASE("buffer_with_time satisfies disposable contracts")
+{
+    test_operator_with_disposable<int>(rpp::ops::buffer_with_time_or_count(std::chrono::seconds{1}, 2, rpp::schedulers::test_scheduler{}));
+}
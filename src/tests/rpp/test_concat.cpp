@@ -269,7 +269,7 @@ TEST_CASE("concat as operator async completiton")
         | rpp::ops::subscribe(mock);
 
 
-    REQUIRE_CALL(*mock, on_next_lvalue(1)).IN_SEQUENCE(s);
+    REQUIRE_CALL(*mock, on_next_rvalue(1)).IN_SEQUENCE(s);
     subj.get_observer().on_next(1);
 
     REQUIRE_CALL(*mock, on_next_lvalue(100)).IN_SEQUENCE(s);
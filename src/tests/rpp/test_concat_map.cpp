@@ -0,0 +1,123 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#include <doctest/doctest.h>
+
+#include <rpp/observables/dynamic_observable.hpp>
+#include <rpp/observers/mock_observer.hpp>
+#include <rpp/operators/concat_map.hpp>
+#include <rpp/sources/create.hpp>
+#include <rpp/sources/just.hpp>
+#include <rpp/subjects/publish_subject.hpp>
+
+#include "disposable_observable.hpp"
+
+#include <stdexcept>
+#include <vector>
+
+TEST_CASE("concat_map")
+{
+    auto mock = mock_observer_strategy<int>();
+
+    SUBCASE("without prefetch emits values of inner observables in order")
+    {
+        rpp::source::just(1, 2, 3)
+            | rpp::ops::concat_map([](int v) { return rpp::source::just(v, v * 10); })
+            | rpp::ops::subscribe(mock);
+
+        CHECK(mock.get_received_values() == std::vector{1, 10, 2, 20, 3, 30});
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+
+    SUBCASE("with prefetch emits values of synchronous inner observables in order")
+    {
+        rpp::source::just(1, 2, 3)
+            | rpp::ops::concat_map([](int v) { return rpp::source::just(v, v * 10); }, 2)
+            | rpp::ops::subscribe(mock);
+
+        CHECK(mock.get_received_values() == std::vector{1, 10, 2, 20, 3, 30});
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+}
+
+TEST_CASE("concat_map with prefetch")
+{
+    auto mock = mock_observer_strategy<int>();
+
+    std::vector<rpp::subjects::publish_subject<int>> subjects(3);
+
+    rpp::source::just(0, 1, 2)
+        | rpp::ops::concat_map([&subjects](int v) { return subjects[static_cast<size_t>(v)].get_observable(); }, 1)
+        | rpp::ops::subscribe(mock);
+
+    SUBCASE("upcoming observable is subscribed eagerly and its values are buffered")
+    {
+        subjects[1].get_observer().on_next(10);
+        subjects[2].get_observer().on_next(20);
+        subjects[0].get_observer().on_next(1);
+        CHECK(mock.get_received_values() == std::vector{1});
+
+        SUBCASE("buffered values are emitted when previous observable completes")
+        {
+            subjects[0].get_observer().on_completed();
+            CHECK(mock.get_received_values() == std::vector{1, 10});
+
+            subjects[2].get_observer().on_next(21);
+            subjects[1].get_observer().on_next(11);
+            CHECK(mock.get_received_values() == std::vector{1, 10, 11});
+
+            SUBCASE("resulting observable completes when all observables completed")
+            {
+                subjects[2].get_observer().on_completed();
+                CHECK(mock.get_on_completed_count() == 0);
+
+                subjects[1].get_observer().on_completed();
+                CHECK(mock.get_received_values() == std::vector{1, 10, 11, 21});
+                CHECK(mock.get_on_completed_count() == 1);
+            }
+        }
+    }
+
+    SUBCASE("error from upcoming observable is forwarded immediately")
+    {
+        subjects[1].get_observer().on_error(std::make_exception_ptr(std::runtime_error{""}));
+        CHECK(mock.get_on_error_count() == 1);
+
+        subjects[0].get_observer().on_next(1);
+        CHECK(mock.get_total_on_next_count() == 0);
+    }
+}
+
+TEST_CASE("concat_map with prefetch doesn't recurse on synchronous inner observables")
+{
+    auto mock = mock_observer_strategy<int>();
+
+    constexpr size_t                    count = 100'000;
+    rpp::subjects::publish_subject<int> first{};
+
+    rpp::source::create<int>([&](const auto& obs) {
+        for (size_t i = 0; i <= count; ++i)
+            obs.on_next(static_cast<int>(i));
+        obs.on_completed();
+    })
+        | rpp::ops::concat_map([&first](int v) { return v == 0 ? first.get_observable().as_dynamic() : rpp::source::just(v).as_dynamic(); }, 4)
+        | rpp::ops::subscribe(mock);
+
+    CHECK(mock.get_total_on_next_count() == 0);
+
+    first.get_observer().on_completed();
+    CHECK(mock.get_total_on_next_count() == count);
+    CHECK(mock.get_on_completed_count() == 1);
+}
+
+TEST_CASE("concat_map satisfies disposable contracts")
+{
+    test_operator_with_disposable<int>(rpp::ops::concat_map([](int v) { return rpp::source::just(v); }, 2));
+}
@@ -232,6 +232,41 @@ TEST_CASE("delay delays observable's emissions")
     }
 }
 
+TEST_CASE("delay emits all ready emissions by single execution")
+{
+    auto                                mock      = mock_observer_strategy<int>{};
+    auto                                scheduler = rpp::schedulers::test_scheduler{};
+    rpp::subjects::publish_subject<int> subj{};
+
+    subj.get_observable() | rpp::ops::delay(std::chrono::seconds{1}, scheduler) | rpp::ops::subscribe(mock);
+
+    subj.get_observer().on_next(1);
+    subj.get_observer().on_next(2);
+    subj.get_observer().on_next(3);
+    scheduler.time_advance(std::chrono::milliseconds{500});
+    subj.get_observer().on_next(4);
+
+    CHECK(scheduler.get_schedulings().size() == 1);
+
+    scheduler.time_advance(std::chrono::milliseconds{500});
+    CHECK(mock.get_received_values() == std::vector{1, 2, 3});
+    CHECK(scheduler.get_executions().size() == 1);
+
+    scheduler.time_advance(std::chrono::milliseconds{500});
+    CHECK(mock.get_received_values() == std::vector{1, 2, 3, 4});
+    CHECK(scheduler.get_executions().size() == 2);
+
+    // drain went idle, so next emission schedules it again, but only once
+    const auto schedulings = scheduler.get_schedulings().size();
+    subj.get_observer().on_next(5);
+    subj.get_observer().on_completed();
+    CHECK(scheduler.get_schedulings().size() == schedulings + 1);
+
+    scheduler.time_advance(std::chrono::seconds{1});
+    CHECK(mock.get_received_values() == std::vector{1, 2, 3, 4, 5});
+    CHECK(mock.get_on_completed_count() == 1);
+}
+
 TEST_CASE("delay satisfies disposable contracts")
 {
     test_operator_with_disposable<int>(rpp::ops::delay(std::chrono::seconds{0}, manual_scheduler{}));
@@ -12,6 +12,7 @@
 
 #include <rpp/observers/mock_observer.hpp>
 #include <rpp/operators/distinct.hpp>
+#include <rpp/sources/create.hpp>
 #include <rpp/sources/empty.hpp>
 #include <rpp/sources/error.hpp>
 #include <rpp/sources/just.hpp>
@@ -19,6 +20,8 @@
 #include "copy_count_tracker.hpp"
 #include "disposable_observable.hpp"
 
+#include <thread>
+
 TEST_CASE_TEMPLATE("distinct filters out repeated values and emit only items that have not already been emitted", TestType, rpp::memory_model::use_stack, rpp::memory_model::use_shared)
 {
     auto mock = mock_observer_strategy<int>{};
@@ -67,3 +70,86 @@ TEST_CASE("distinct satisfies disposable contracts")
 {
     test_operator_with_disposable<int>(rpp::ops::distinct());
 }
+
+TEST_CASE("distinct with window remembers only recent values")
+{
+    auto mock = mock_observer_strategy<int>{};
+
+    SUBCASE("least recently seen value is forgotten when max_count exceeded")
+    {
+        rpp::source::just(1, 2, 1, 3, 1, 2, 3)
+            | rpp::ops::distinct(rpp::ops::distinct_window{.max_count = 2})
+            | rpp::ops::subscribe(mock);
+
+        // 2 forgotten by 3 as 1 was refreshed, then 3 forgotten by 2
+        CHECK(mock.get_received_values() == std::vector{1, 2, 3, 2, 3});
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+
+    SUBCASE("value is forgotten after duration")
+    {
+        rpp::source::create<int>([](const auto& obs) {
+            obs.on_next(1);
+            obs.on_next(1);
+            std::this_thread::sleep_for(std::chrono::milliseconds{50});
+            obs.on_next(1);
+            obs.on_completed();
+        })
+            | rpp::ops::distinct(rpp::ops::distinct_window{.duration = std::chrono::milliseconds{10}})
+            | rpp::ops::subscribe(mock);
+
+        CHECK(mock.get_received_values() == std::vector{1, 1});
+    }
+
+    SUBCASE("without limits behaves as distinct")
+    {
+        rpp::source::just(1, 1, 2, 2, 3, 4, 4, 2, 2, 1, 3)
+            | rpp::ops::distinct(rpp::ops::distinct_window{})
+            | rpp::ops::subscribe(mock);
+
+        CHECK(mock.get_received_values() == std::vector{1, 2, 3, 4});
+    }
+}
+
+TEST_CASE("distinct with bloom filter filters out repeated values")
+{
+    auto mock = mock_observer_strategy<int>{};
+
+    SUBCASE("repeated values are never emitted while remembered")
+    {
+        rpp::source::just(1, 1, 2, 2, 3, 4, 4, 2, 2, 1, 3)
+            | rpp::ops::distinct(rpp::ops::distinct_bloom{.expected_count = 100})
+            | rpp::ops::subscribe(mock);
+
+        CHECK(mock.get_received_values() == std::vector{1, 2, 3, 4});
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+
+    SUBCASE("false positives rate is close to configured one")
+    {
+        constexpr int count = 10'000;
+        rpp::source::create<int>([](const auto& obs) {
+            for (int i = 0; i < count; ++i)
+                obs.on_next(i);
+        })
+            | rpp::ops::distinct(rpp::ops::distinct_bloom{.expected_count = count, .false_positive_rate = 0.01})
+            | rpp::ops::subscribe(mock);
+
+        CHECK(mock.get_total_on_next_count() >= count * 97 / 100);
+    }
+
+    SUBCASE("old values are forgotten after 2 generations")
+    {
+        rpp::source::just(1, 2, 3, 4, 5, 1)
+            | rpp::ops::distinct(rpp::ops::distinct_bloom{.expected_count = 2, .false_positive_rate = 0.0001})
+            | rpp::ops::subscribe(mock);
+
+        CHECK(mock.get_received_values() == std::vector{1, 2, 3, 4, 5, 1});
+    }
+}
+
+TEST_CASE("bounded distinct satisfies disposable contracts")
+{
+    test_operator_with_disposable<int>(rpp::ops::distinct(rpp::ops::distinct_window{.max_count = 10}));
+    test_operator_with_disposable<int>(rpp::ops::distinct(rpp::ops::distinct_bloom{.expected_count = 10}));
+}
@@ -11,7 +11,9 @@
 #include <doctest/doctest.h>
 
 #include <rpp/observers/mock_observer.hpp>
+#include <rpp/operators/as_blocking.hpp>
 #include <rpp/operators/take.hpp>
+#include <rpp/schedulers/new_thread.hpp>
 #include <rpp/sources/from.hpp>
 
 #include "copy_count_tracker.hpp"
@@ -24,7 +26,11 @@
 
 #include <cstddef>
 #include <functional>
+#include <list>
 #include <optional>
+#include <ranges>
+#include <set>
+#include <span>
 #include <stdexcept>
 
 struct my_container_with_error : std::vector<int>
@@ -228,6 +234,141 @@ TEST_CASE_TEMPLATE("from iterable doesn't provides extra copies", TestType, rpp:
     }
 }
 
+TEST_CASE("from iterable keeps position between schedulings")
+{
+    auto mock = mock_observer_strategy<int>();
+
+    SUBCASE("non-random-access container emits items in the same order via new_thread")
+    {
+        std::list<int> vals{};
+        for (int i = 0; i < 1000; ++i)
+            vals.push_back(i);
+
+        rpp::source::from_iterable(vals, rpp::schedulers::new_thread{}) | rpp::operators::as_blocking() | rpp::operators::subscribe(mock);
+
+        CHECK(mock.get_received_values() == std::vector<int>{vals.begin(), vals.end()});
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+
+    SUBCASE("batch_size items are emitted per scheduling")
+    {
+        rpp::schedulers::current_thread::create_worker().schedule([&mock](const auto&) {
+            rpp::source::from_iterable(std::set{1, 2, 3, 4, 5}, rpp::schedulers::current_thread{}, 2).subscribe(mock);
+            rpp::source::from_iterable(std::set{10, 20, 30}, rpp::schedulers::current_thread{}, 2).subscribe(mock);
+            return rpp::schedulers::optional_delay_from_now{};
+        },
+                                                                  mock);
+
+        CHECK(mock.get_received_values() == std::vector{1, 2, 10, 20, 3, 4, 30, 5});
+        CHECK(mock.get_on_completed_count() == 2);
+    }
+
+    SUBCASE("batch is interrupted by disposing")
+    {
+        rpp::source::from_iterable(std::list{1, 2, 3, 4, 5}, rpp::schedulers::current_thread{}, 10) | rpp::operators::take(2) | rpp::operators::subscribe(mock);
+
+        CHECK(mock.get_received_values() == std::vector{1, 2});
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+}
+
+TEST_CASE("from_span emits items without copies")
+{
+    copy_count_tracker tracker{};
+    auto               vals         = std::vector{tracker, tracker};
+    auto               initial_copy = tracker.get_copy_count();
+    auto               initial_move = tracker.get_move_count();
+
+    SUBCASE("non-owning span")
+    {
+        auto obs = rpp::source::from_span(vals);
+        obs.subscribe([](const auto&) {});
+        obs.subscribe([](const auto&) {});
+        CHECK(tracker.get_copy_count() - initial_copy == 0);
+        CHECK(tracker.get_move_count() - initial_move == 0);
+    }
+
+    SUBCASE("span owned by shared_ptr")
+    {
+        auto owner = std::make_shared<std::vector<copy_count_tracker>>(std::move(vals));
+        initial_move = tracker.get_move_count();
+
+        auto obs = rpp::source::from_span(owner, rpp::schedulers::immediate{});
+        owner.reset();
+        obs.subscribe([](const auto&) {});
+        CHECK(tracker.get_copy_count() - initial_copy == 0);
+        CHECK(tracker.get_move_count() - initial_move == 0);
+    }
+}
+
+TEST_CASE("from_span emits items in the same order")
+{
+    auto mock = mock_observer_strategy<int>();
+
+    SUBCASE("from vector via current_thread with batches")
+    {
+        const auto vals = std::vector{1, 2, 3, 4, 5};
+        rpp::source::from_span(vals, rpp::schedulers::current_thread{}, 2).subscribe(mock);
+        CHECK(mock.get_received_values() == vals);
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+
+    SUBCASE("from subspan")
+    {
+        const std::array vals{1, 2, 3, 4, 5};
+        rpp::source::from_span(std::span{vals}.subspan(1, 3), rpp::schedulers::immediate{}).subscribe(mock);
+        CHECK(mock.get_received_values() == std::vector{2, 3, 4});
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+}
+
+TEST_CASE("from_range lazily emits items of view")
+{
+    auto mock = mock_observer_strategy<int>();
+
+    SUBCASE("infinite view limited by take")
+    {
+        size_t transform_calls{};
+        auto   obs = rpp::source::from_range(std::views::iota(1)
+                                             | std::views::filter([](int v) { return v % 2 == 0; })
+                                             | std::views::transform([&](int v) { ++transform_calls; return v * 10; })
+                                             | std::views::take(3));
+        CHECK(transform_calls == 0);
+
+        obs.subscribe(mock);
+        obs.subscribe(mock);
+        CHECK(mock.get_received_values() == std::vector{20, 40, 60, 20, 40, 60});
+        CHECK(mock.get_on_completed_count() == 2);
+        CHECK(transform_calls == 6);
+    }
+
+    SUBCASE("view is iterated via scheduler")
+    {
+        rpp::source::from_range(std::views::iota(0, 1000) | std::views::filter([](int v) { return v % 100 == 0; }), rpp::schedulers::new_thread{}, 3)
+            | rpp::operators::as_blocking()
+            | rpp::operators::subscribe(mock);
+
+        CHECK(mock.get_received_values() == std::vector{0, 100, 200, 300, 400, 500, 600, 700, 800, 900});
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+
+    SUBCASE("lvalue container is referenced by observable")
+    {
+        std::list vals{1, 2, 3};
+        auto      obs = rpp::source::from_range(vals);
+        vals.push_back(4);
+        obs.subscribe(mock);
+        CHECK(mock.get_received_values() == std::vector{1, 2, 3, 4});
+    }
+
+    SUBCASE("take(1) from infinite view")
+    {
+        rpp::source::from_range(std::views::iota(5)) | rpp::operators::take(1) | rpp::operators::subscribe(mock);
+        CHECK(mock.get_received_values() == std::vector{5});
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+}
+
 TEST_CASE("from callable")
 {
     auto mock = mock_observer_strategy<int>{};
@@ -0,0 +1,121 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#include <doctest/doctest.h>
+
+#include <rpp/observers/mock_observer.hpp>
+#include <rpp/operators/as_blocking.hpp>
+#include <rpp/operators/map.hpp>
+#include <rpp/operators/take.hpp>
+#include <rpp/schedulers/immediate.hpp>
+#include <rpp/schedulers/new_thread.hpp>
+#include <rpp/sources/from_mapped_file.hpp>
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace
+{
+    std::string to_string(std::span<const std::byte> bytes)
+    {
+        return std::string{reinterpret_cast<const char*>(bytes.data()), bytes.size()};
+    }
+
+    struct temp_file
+    {
+        explicit temp_file(const std::string& content)
+        {
+            std::ofstream stream{path, std::ios::binary};
+            stream << content;
+        }
+
+        ~temp_file()
+        {
+            std::error_code ec{};
+            std::filesystem::remove(path, ec);
+        }
+
+        const std::filesystem::path path = std::filesystem::temp_directory_path() / "rpp_from_mapped_file_test.bin";
+    };
+} // namespace
+
+TEST_CASE("from_mapped_file emits content of file by chunks")
+{
+    auto mock = mock_observer_strategy<std::string>();
+
+    SUBCASE("chunks of fixed size with smaller last one")
+    {
+        const temp_file file{"0123456789"};
+
+        rpp::source::from_mapped_file(file.path, 4, rpp::schedulers::immediate{})
+            | rpp::operators::map(&to_string)
+            | rpp::operators::subscribe(mock);
+
+        CHECK(mock.get_received_values() == std::vector<std::string>{"0123", "4567", "89"});
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+
+    SUBCASE("chunks crossing page boundaries via new_thread")
+    {
+        std::string content{};
+        for (size_t i = 0; i < 3 * rpp::utils::mapped_file::granularity() + 17; ++i)
+            content.push_back(static_cast<char>('a' + i % 26));
+        const temp_file file{content};
+
+        rpp::source::from_mapped_file(file.path, 1000, rpp::schedulers::new_thread{})
+            | rpp::operators::map(&to_string)
+            | rpp::operators::as_blocking()
+            | rpp::operators::subscribe(mock);
+
+        std::string received{};
+        for (const auto& chunk : mock.get_received_values())
+        {
+            CHECK(chunk.size() <= 1000);
+            received += chunk;
+        }
+        CHECK(received == content);
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+
+    SUBCASE("empty file emits only on_completed")
+    {
+        const temp_file file{""};
+
+        rpp::source::from_mapped_file(file.path, 4) | rpp::operators::map(&to_string) | rpp::operators::subscribe(mock);
+
+        CHECK(mock.get_total_on_next_count() == 0);
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+
+    SUBCASE("take(1) stops reading of file")
+    {
+        const temp_file file{"0123456789"};
+
+        rpp::source::from_mapped_file(file.path, 3) | rpp::operators::map(&to_string) | rpp::operators::take(1) | rpp::operators::subscribe(mock);
+
+        CHECK(mock.get_received_values() == std::vector<std::string>{"012"});
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+}
+
+TEST_CASE("from_mapped_file emits error for missing file")
+{
+    auto mock = mock_observer_strategy<std::span<const std::byte>>();
+
+    rpp::source::from_mapped_file(std::filesystem::temp_directory_path() / "rpp_from_mapped_file_missing.bin", 4).subscribe(mock);
+
+    CHECK(mock.get_total_on_next_count() == 0);
+    CHECK(mock.get_on_error_count() == 1);
+    CHECK(mock.get_on_completed_count() == 0);
+}
@@ -24,6 +24,7 @@
 #include "rpp/disposables/fwd.hpp"
 
 #include <functional>
+#include <thread>
 
 TEST_CASE("group_by emits grouped seqences of values with identity key selector")
 {
@@ -291,3 +292,88 @@ TEST_CASE("group_by satisfies disposable contracts")
 {
     test_operator_with_disposable<int>(rpp::ops::group_by([](int) { return 0; }));
 }
+
+TEST_CASE("hash_group_by emits grouped seqences of values")
+{
+    std::map<int, mock_observer_strategy<int>> grouped_mocks{};
+
+    rpp::source::just(1, 2, 3, 4, 4, 3, 2, 1)
+        | rpp::ops::hash_group_by([](int v) { return v % 2; })
+        | rpp::ops::subscribe([&](const auto& grouped) {
+              REQUIRE(grouped_mocks.contains(grouped.get_key()) == false);
+              grouped.subscribe(grouped_mocks[grouped.get_key()]);
+          });
+
+    REQUIRE(grouped_mocks.size() == 2);
+    CHECK(grouped_mocks[0].get_received_values() == std::vector{2, 4, 4, 2});
+    CHECK(grouped_mocks[1].get_received_values() == std::vector{1, 3, 3, 1});
+    CHECK(grouped_mocks[0].get_on_completed_count() == 1);
+    CHECK(grouped_mocks[1].get_on_completed_count() == 1);
+}
+
+TEST_CASE("hash_group_by evicts groups")
+{
+    std::vector<std::pair<int, mock_observer_strategy<int>>> groups{};
+    const auto                                               subscribe_groups = rpp::ops::subscribe([&](const rpp::grouped_observable_group_by<int, int>& grouped) {
+        groups.emplace_back(grouped.get_key(), mock_observer_strategy<int>{});
+        grouped.subscribe(groups.back().second);
+    });
+
+    SUBCASE("least recently used group is completed when max_groups exceeded")
+    {
+        rpp::source::just(1, 2, 1, 3, 2, 1)
+            | rpp::ops::hash_group_by(std::identity{}, std::identity{}, rpp::ops::group_by_eviction{.max_groups = 2})
+            | subscribe_groups;
+
+        // 2 evicted by 3, then 1 evicted by 2
+        REQUIRE(groups.size() == 5);
+        CHECK(groups[0].first == 1);
+        CHECK(groups[0].second.get_received_values() == std::vector{1, 1});
+        CHECK(groups[0].second.get_on_completed_count() == 1);
+        CHECK(groups[1].first == 2);
+        CHECK(groups[1].second.get_received_values() == std::vector{2});
+        CHECK(groups[1].second.get_on_completed_count() == 1);
+        CHECK(groups[2].first == 3);
+        CHECK(groups[3].first == 2);
+        CHECK(groups[4].first == 1);
+        CHECK(groups[4].second.get_received_values() == std::vector{1});
+    }
+
+    SUBCASE("idle group is completed on next emission after idle timeout")
+    {
+        rpp::source::create<int>([](const auto& obs) {
+            obs.on_next(1);
+            obs.on_next(2);
+            std::this_thread::sleep_for(std::chrono::milliseconds{50});
+            obs.on_next(2);
+            obs.on_completed();
+        })
+            | rpp::ops::hash_group_by(std::identity{}, std::identity{}, rpp::ops::group_by_eviction{.idle_timeout = std::chrono::milliseconds{10}})
+            | subscribe_groups;
+
+        REQUIRE(groups.size() == 3);
+        CHECK(groups[0].first == 1);
+        CHECK(groups[1].first == 2);
+        CHECK(groups[1].second.get_received_values() == std::vector{2});
+        CHECK(groups[2].first == 2);
+        CHECK(groups[2].second.get_received_values() == std::vector{2});
+        for (const auto& [key, mock] : groups)
+            CHECK(mock.get_on_completed_count() == 1);
+    }
+
+    SUBCASE("active groups are not evicted")
+    {
+        rpp::source::just(1, 2, 1, 2)
+            | rpp::ops::hash_group_by(std::identity{}, std::identity{}, rpp::ops::group_by_eviction{.max_groups = 2, .idle_timeout = std::chrono::hours{1}})
+            | subscribe_groups;
+
+        REQUIRE(groups.size() == 2);
+        CHECK(groups[0].second.get_received_values() == std::vector{1, 1});
+        CHECK(groups[1].second.get_received_values() == std::vector{2, 2});
+    }
+}
+
+TEST_CASE("hash_group_by satisfies disposable contracts")
+{
+    test_operator_with_disposable<int>(rpp::ops::hash_group_by([](int) { return 0; }, std::identity{}, rpp::ops::group_by_eviction{.max_groups = 1}));
+}
@@ -20,12 +20,15 @@
 #include <rpp/sources/error.hpp>
 #include <rpp/sources/just.hpp>
 #include <rpp/sources/never.hpp>
+#include <rpp/subjects/publish_subject.hpp>
 
 #include "copy_count_tracker.hpp"
 #include "disposable_observable.hpp"
 
 #include <stdexcept>
 #include <string>
+#include <thread>
+#include <vector>
 
 TEST_CASE_TEMPLATE("merge for observable of observables", TestType, rpp::memory_model::use_stack, rpp::memory_model::use_shared)
 {
@@ -179,6 +182,77 @@ TEST_CASE_TEMPLATE("merge_with", TestType, rpp::memory_model::use_stack, rpp::me
     }
 }
 
+TEST_CASE("merge with max_concurrent")
+{
+    auto mock = mock_observer_strategy<int>();
+
+    rpp::subjects::publish_subject<int> s1{};
+    rpp::subjects::publish_subject<int> s2{};
+    rpp::subjects::publish_subject<int> s3{};
+
+    rpp::source::just(s1.get_observable(), s2.get_observable(), s3.get_observable())
+        | rpp::ops::merge(2)
+        | rpp::ops::subscribe(mock);
+
+    SUBCASE("only first max_concurrent observables are subscribed")
+    {
+        s1.get_observer().on_next(1);
+        s2.get_observer().on_next(2);
+        s3.get_observer().on_next(3);
+        CHECK(mock.get_received_values() == std::vector{1, 2});
+
+        SUBCASE("queued observable is subscribed when active one completes")
+        {
+            s1.get_observer().on_completed();
+            s3.get_observer().on_next(4);
+            s1.get_observer().on_next(5);
+            CHECK(mock.get_received_values() == std::vector{1, 2, 4});
+            CHECK(mock.get_on_completed_count() == 0);
+
+            SUBCASE("resulting observable completes when all observables completed")
+            {
+                s2.get_observer().on_completed();
+                CHECK(mock.get_on_completed_count() == 0);
+                s3.get_observer().on_completed();
+                CHECK(mock.get_on_completed_count() == 1);
+            }
+        }
+    }
+    SUBCASE("error from active observable is forwarded and queued observables are dropped")
+    {
+        s2.get_observer().on_error({});
+        CHECK(mock.get_on_error_count() == 1);
+        CHECK(!s3.get_disposable().is_disposed());
+
+        s1.get_observer().on_completed();
+        s3.get_observer().on_next(3);
+        CHECK(mock.get_total_on_next_count() == 0);
+    }
+}
+
+TEST_CASE("merge with max_concurrent subscribes queued observables without recursion")
+{
+    auto mock = mock_observer_strategy<int>();
+
+    rpp::subjects::publish_subject<int> first{};
+    constexpr size_t                    count = 100'000;
+
+    rpp::source::create<rpp::dynamic_observable<int>>([&](const auto& obs) {
+        obs.on_next(first.get_observable().as_dynamic());
+        for (size_t i = 0; i < count; ++i)
+            obs.on_next(rpp::source::just(1).as_dynamic());
+        obs.on_completed();
+    })
+        | rpp::ops::merge(1)
+        | rpp::ops::subscribe(mock);
+
+    CHECK(mock.get_total_on_next_count() == 0);
+
+    first.get_observer().on_completed();
+    CHECK(mock.get_total_on_next_count() == count);
+    CHECK(mock.get_on_completed_count() == 1);
+}
+
 TEST_CASE_TEMPLATE("merge serializes emissions", TestType, rpp::memory_model::use_stack, rpp::memory_model::use_shared)
 {
     SUBCASE("observables from different threads")
@@ -206,6 +280,31 @@ TEST_CASE_TEMPLATE("merge serializes emissions", TestType, rpp::memory_model::us
     }
 }
 
+TEST_CASE("merge doesn't block producer while other producer emits")
+{
+    rpp::subjects::publish_subject<int> s1{};
+    rpp::subjects::publish_subject<int> s2{};
+
+    std::vector<int> values{};
+    std::thread      t{};
+
+    s1.get_observable()
+        | rpp::ops::merge_with(s2.get_observable())
+        | rpp::ops::subscribe([&](int v) {
+              values.push_back(v);
+              if (v != 1)
+                  return;
+
+              // other producer emits while this thread is emitting and returns without waiting for it
+              t = std::thread{[obs = s2.get_observer()] { obs.on_next(2); }};
+              t.join();
+              CHECK(values == std::vector{1});
+          });
+
+    s1.get_observer().on_next(1);
+    CHECK(values == std::vector{1, 2});
+}
+
 TEST_CASE_TEMPLATE("merge handles race condition", TestType, rpp::memory_model::use_stack, rpp::memory_model::use_shared)
 {
     SUBCASE("source observable in current thread pairs with error in other thread")
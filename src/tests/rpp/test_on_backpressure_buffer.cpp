@@ -0,0 +1,210 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#include <doctest/doctest.h>
+
+#include <rpp/observers/mock_observer.hpp>
+#include <rpp/operators/as_blocking.hpp>
+#include <rpp/operators/on_backpressure_buffer.hpp>
+#include <rpp/schedulers/new_thread.hpp>
+#include <rpp/sources/create.hpp>
+#include <rpp/sources/just.hpp>
+#include <rpp/subjects/publish_subject.hpp>
+
+#include "disposable_observable.hpp"
+
+namespace
+{
+    class manual_scheduler final
+    {
+    public:
+        class worker_strategy
+        {
+        public:
+            inline static rpp::schedulers::details::schedulables_queue<worker_strategy> s_test_queue{};
+            template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, rpp::schedulers::constraint::schedulable_fn<Handler, Args...> Fn>
+            void defer_for(rpp::schedulers::duration duration, Fn&& fn, Handler&& handler, Args&&... args) const
+            {
+                s_test_queue.emplace(rpp::schedulers::time_point{duration}, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+            }
+
+            static rpp::disposable_wrapper     get_disposable() { return rpp::disposable_wrapper::make<rpp::composite_disposable>(); }
+            static rpp::schedulers::time_point now() { return rpp::schedulers::clock_type::now(); }
+        };
+
+        static rpp::schedulers::worker<worker_strategy> create_worker()
+        {
+            worker_strategy::s_test_queue = rpp::schedulers::details::schedulables_queue<worker_strategy>{};
+            return rpp::schedulers::worker<worker_strategy>{};
+        }
+
+        static void drain()
+        {
+            while (!worker_strategy::s_test_queue.is_empty())
+            {
+                auto fn = worker_strategy::s_test_queue.top();
+                worker_strategy::s_test_queue.pop();
+                if (!fn->is_disposed())
+                    (*fn)();
+            }
+        }
+    };
+} // namespace
+
+TEST_CASE("on_backpressure_buffer keeps at most capacity values")
+{
+    auto   mock    = mock_observer_strategy<int>{};
+    auto   subj    = rpp::subjects::publish_subject<int>{};
+    size_t dropped = 0;
+
+    auto send_values = [obs = subj.get_observer()] {
+        for (int i = 1; i <= 5; ++i)
+            obs.on_next(i);
+    };
+
+    SUBCASE("DropNewest policy")
+    {
+        subj.get_observable()
+            | rpp::ops::on_backpressure_buffer(2, manual_scheduler{}, rpp::ops::backpressure_overflow::DropNewest, [&](size_t count) { dropped = count; })
+            | rpp::ops::subscribe(mock);
+        send_values();
+
+        SUBCASE("observer sees nothing before draining")
+        {
+            CHECK(mock.get_received_values().empty());
+            CHECK(dropped == 3);
+        }
+
+        manual_scheduler::drain();
+
+        SUBCASE("observer sees first values")
+        {
+            CHECK(mock.get_received_values() == std::vector{1, 2});
+            CHECK(mock.get_on_completed_count() == 0);
+        }
+
+        SUBCASE("queue accepts new values after draining")
+        {
+            subj.get_observer().on_next(6);
+            subj.get_observer().on_completed();
+            manual_scheduler::drain();
+
+            CHECK(mock.get_received_values() == std::vector{1, 2, 6});
+            CHECK(mock.get_on_completed_count() == 1);
+            CHECK(dropped == 3);
+        }
+    }
+
+    SUBCASE("DropOldest policy")
+    {
+        subj.get_observable()
+            | rpp::ops::on_backpressure_buffer(2, manual_scheduler{}, rpp::ops::backpressure_overflow::DropOldest, [&](size_t count) { dropped = count; })
+            | rpp::ops::subscribe(mock);
+        send_values();
+        subj.get_observer().on_completed();
+        manual_scheduler::drain();
+
+        CHECK(mock.get_received_values() == std::vector{4, 5});
+        CHECK(mock.get_on_completed_count() == 1);
+        CHECK(dropped == 3);
+    }
+
+    SUBCASE("Error policy")
+    {
+        auto d = rpp::composite_disposable_wrapper::make();
+        rpp::source::create<int>([&](auto&& obs) {
+            obs.set_upstream(rpp::disposable_wrapper{d});
+            for (int i = 1; i <= 5; ++i)
+                obs.on_next(i);
+        })
+            | rpp::ops::on_backpressure_buffer(2, manual_scheduler{}, rpp::ops::backpressure_overflow::Error)
+            | rpp::ops::subscribe(mock);
+
+        SUBCASE("source is disposed")
+        {
+            CHECK(d.is_disposed());
+        }
+
+        manual_scheduler::drain();
+
+        SUBCASE("observer sees only error")
+        {
+            CHECK(mock.get_received_values().empty());
+            CHECK(mock.get_on_error_count() == 1);
+            CHECK(mock.get_on_completed_count() == 0);
+        }
+    }
+}
+
+TEST_CASE("on_backpressure_drop and on_backpressure_latest keep single value")
+{
+    auto   mock    = mock_observer_strategy<int>{};
+    size_t dropped = 0;
+
+    SUBCASE("on_backpressure_drop keeps first value")
+    {
+        rpp::source::just(1, 2, 3, 4, 5)
+            | rpp::ops::on_backpressure_drop(manual_scheduler{}, [&](size_t count) { dropped = count; })
+            | rpp::ops::subscribe(mock);
+        manual_scheduler::drain();
+
+        CHECK(mock.get_received_values() == std::vector{1});
+        CHECK(mock.get_on_completed_count() == 1);
+        CHECK(dropped == 4);
+    }
+
+    SUBCASE("on_backpressure_latest keeps last value")
+    {
+        rpp::source::just(1, 2, 3, 4, 5)
+            | rpp::ops::on_backpressure_latest(manual_scheduler{}, [&](size_t count) { dropped = count; })
+            | rpp::ops::subscribe(mock);
+        manual_scheduler::drain();
+
+        CHECK(mock.get_received_values() == std::vector{5});
+        CHECK(mock.get_on_completed_count() == 1);
+        CHECK(dropped == 4);
+    }
+
+    SUBCASE("error cancels pending values")
+    {
+        rpp::source::create<int>([](const auto& obs) {
+            obs.on_next(1);
+            obs.on_error({});
+        })
+            | rpp::ops::on_backpressure_latest(manual_scheduler{})
+            | rpp::ops::subscribe(mock);
+        manual_scheduler::drain();
+
+        CHECK(mock.get_received_values().empty());
+        CHECK(mock.get_on_error_count() == 1);
+    }
+}
+
+TEST_CASE("on_backpressure_buffer with Block policy doesn't lose values")
+{
+    auto mock = mock_observer_strategy<int>{};
+
+    rpp::source::create<int>([](const auto& obs) {
+        for (int i = 0; i < 1000; ++i)
+            obs.on_next(i);
+        obs.on_completed();
+    })
+        | rpp::ops::on_backpressure_buffer(2, rpp::schedulers::new_thread{}, rpp::ops::backpressure_overflow::Block)
+        | rpp::ops::as_blocking()
+        | rpp::ops::subscribe(mock);
+
+    CHECK(mock.get_received_values().size() == 1000);
+    CHECK(mock.get_on_completed_count() == 1);
+}
+
+TEST_CASE("on_backpressure_buffer satisfies disposable contracts")
+{
+    test_operator_with_disposable<int>(rpp::ops::on_backpressure_buffer(2, manual_scheduler{}));
+}
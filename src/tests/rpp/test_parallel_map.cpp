@@ -0,0 +1,148 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#include <doctest/doctest.h>
+
+#include <rpp/observers/mock_observer.hpp>
+#include <rpp/operators/as_blocking.hpp>
+#include <rpp/operators/parallel_map.hpp>
+#include <rpp/schedulers/immediate.hpp>
+#include <rpp/schedulers/thread_pool.hpp>
+#include <rpp/sources/from.hpp>
+#include <rpp/sources/just.hpp>
+
+#include "disposable_observable.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    std::vector<int> make_values(size_t count)
+    {
+        std::vector<int> values(count);
+        std::iota(values.begin(), values.end(), 0);
+        return values;
+    }
+
+    std::vector<int> multiply_by_10(std::vector<int> values)
+    {
+        for (auto& v : values)
+            v *= 10;
+        return values;
+    }
+} // namespace
+
+TEST_CASE("parallel_map applies function in parallel and keeps order")
+{
+    auto       mock   = mock_observer_strategy<int>{};
+    const auto values = make_values(200);
+
+    // first items are the slowest ones, so results of following items are obtained earlier
+    const auto fn = [](int v) {
+        if (v < 4)
+            std::this_thread::sleep_for(std::chrono::milliseconds{10 * (4 - v)});
+        return v * 10;
+    };
+
+    SUBCASE("ordered results are emitted in original order")
+    {
+        rpp::source::from_iterable(values)
+            | rpp::ops::parallel_map(fn, rpp::schedulers::thread_pool{4}, 16)
+            | rpp::ops::as_blocking()
+            | rpp::ops::subscribe(mock);
+
+        CHECK(mock.get_received_values() == multiply_by_10(values));
+        CHECK(mock.get_on_error_count() == 0);
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+
+    SUBCASE("unordered results contain all values")
+    {
+        rpp::source::from_iterable(values)
+            | rpp::ops::parallel_map_unordered(fn, rpp::schedulers::thread_pool{4}, 16)
+            | rpp::ops::as_blocking()
+            | rpp::ops::subscribe(mock);
+
+        auto received = mock.get_received_values();
+        std::sort(received.begin(), received.end());
+        CHECK(received == multiply_by_10(values));
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+
+    SUBCASE("immediate scheduler works as map")
+    {
+        rpp::source::just(1, 2, 3)
+            | rpp::ops::parallel_map([](int v) { return v * 10; }, rpp::schedulers::immediate{}, 1)
+            | rpp::ops::subscribe(mock);
+
+        CHECK(mock.get_received_values() == std::vector{10, 20, 30});
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+}
+
+TEST_CASE("parallel_map limits amount of items in flight")
+{
+    std::atomic<size_t> current{};
+    std::atomic<size_t> max_observed{};
+
+    const auto values = make_values(100);
+    auto       mock   = mock_observer_strategy<int>{};
+
+    rpp::source::from_iterable(values)
+        | rpp::ops::parallel_map([&](int v) {
+              const auto now = ++current;
+              size_t     prev = max_observed.load();
+              while (prev < now && !max_observed.compare_exchange_weak(prev, now))
+              {
+              }
+              std::this_thread::sleep_for(std::chrono::microseconds{100});
+              --current;
+              return v;
+          },
+                                 rpp::schedulers::thread_pool{8},
+                                 2)
+        | rpp::ops::as_blocking()
+        | rpp::ops::subscribe(mock);
+
+    CHECK(mock.get_received_values() == values);
+    CHECK(max_observed.load() <= 2);
+}
+
+TEST_CASE("parallel_map forwards error thrown by function")
+{
+    auto mock = mock_observer_strategy<int>{};
+
+    rpp::source::from_iterable(make_values(10))
+        | rpp::ops::parallel_map([](int v) {
+              if (v == 5)
+                  throw std::runtime_error{"error"};
+              return v;
+          },
+                                 rpp::schedulers::thread_pool{2},
+                                 4)
+        | rpp::ops::as_blocking()
+        | rpp::ops::subscribe(mock);
+
+    CHECK(mock.get_on_error_count() == 1);
+    CHECK(mock.get_on_completed_count() == 0);
+    CHECK(mock.get_total_on_next_count() <= 5);
+}
+
+TEST_CASE("parallel_map satisfies disposable contracts")
+{
+    test_operator_with_disposable<int>(rpp::ops::parallel_map([](int v) { return v; }, rpp::schedulers::immediate{}, 2));
+    test_operator_with_disposable<int>(rpp::ops::parallel_map_unordered([](int v) { return v; }, rpp::schedulers::immediate{}, 2));
+}
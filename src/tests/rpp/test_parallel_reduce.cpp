@@ -0,0 +1,159 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#include <doctest/doctest.h>
+
+#include <rpp/observers/mock_observer.hpp>
+#include <rpp/operators/as_blocking.hpp>
+#include <rpp/operators/parallel_reduce.hpp>
+#include <rpp/schedulers/immediate.hpp>
+#include <rpp/schedulers/thread_pool.hpp>
+#include <rpp/sources/create.hpp>
+#include <rpp/sources/empty.hpp>
+#include <rpp/sources/error.hpp>
+#include <rpp/sources/from.hpp>
+
+#include "disposable_observable.hpp"
+
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+TEST_CASE("parallel_reduce reduces chunks in parallel and merges partial results")
+{
+    std::vector<int> values(1000);
+    std::iota(values.begin(), values.end(), 1);
+
+    SUBCASE("sum is the same as sequential one")
+    {
+        auto mock = mock_observer_strategy<long long>{};
+        rpp::source::from_iterable(values)
+            | rpp::ops::parallel_reduce(0LL, [](long long s, int v) { return s + v; }, [](long long l, long long r) { return l + r; }, rpp::schedulers::thread_pool{4}, 7)
+            | rpp::ops::as_blocking()
+            | rpp::ops::subscribe(mock);
+
+        CHECK(mock.get_received_values() == std::vector<long long>{500500});
+        CHECK(mock.get_on_error_count() == 0);
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+
+    SUBCASE("partial results are merged in order of chunks")
+    {
+        std::string expected{};
+        for (int v : values)
+            expected += std::to_string(v % 10);
+
+        auto mock = mock_observer_strategy<std::string>{};
+        rpp::source::from_iterable(values)
+            | rpp::ops::parallel_reduce(std::string{}, [](std::string s, int v) { return s += std::to_string(v % 10); }, [](std::string l, const std::string& r) { return l += r; }, rpp::schedulers::thread_pool{4}, 3)
+            | rpp::ops::as_blocking()
+            | rpp::ops::subscribe(mock);
+
+        CHECK(mock.get_received_values() == std::vector{expected});
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+
+    SUBCASE("immediate scheduler works as reduce")
+    {
+        auto mock = mock_observer_strategy<int>{};
+        rpp::source::from_iterable(values)
+            | rpp::ops::parallel_reduce(0, [](int s, int v) { return std::max(s, v); }, [](int l, int r) { return std::max(l, r); }, rpp::schedulers::immediate{}, 16)
+            | rpp::ops::subscribe(mock);
+
+        CHECK(mock.get_received_values() == std::vector{1000});
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+}
+
+TEST_CASE("parallel_reduce emits seed for empty observable")
+{
+    auto mock = mock_observer_strategy<int>{};
+    rpp::source::empty<int>()
+        | rpp::ops::parallel_reduce(42, std::plus<int>{}, std::plus<int>{}, rpp::schedulers::thread_pool{2})
+        | rpp::ops::as_blocking()
+        | rpp::ops::subscribe(mock);
+
+    CHECK(mock.get_received_values() == std::vector{42});
+    CHECK(mock.get_on_completed_count() == 1);
+}
+
+TEST_CASE("parallel_reduce forwards errors")
+{
+    SUBCASE("error from source")
+    {
+        auto mock = mock_observer_strategy<int>{};
+        rpp::source::error<int>({})
+            | rpp::ops::parallel_reduce(0, std::plus<int>{}, std::plus<int>{}, rpp::schedulers::thread_pool{2})
+            | rpp::ops::as_blocking()
+            | rpp::ops::subscribe(mock);
+
+        CHECK(mock.get_total_on_next_count() == 0);
+        CHECK(mock.get_on_error_count() == 1);
+        CHECK(mock.get_on_completed_count() == 0);
+    }
+
+    SUBCASE("error thrown by combine")
+    {
+        std::vector<int> values(100);
+        std::iota(values.begin(), values.end(), 0);
+
+        auto mock = mock_observer_strategy<int>{};
+        rpp::source::from_iterable(values)
+            | rpp::ops::parallel_reduce(0, [](int s, int v) {
+                  if (v == 50)
+                      throw std::runtime_error{"error"};
+                  return s + v;
+              },
+                                        std::plus<int>{},
+                                        rpp::schedulers::thread_pool{2},
+                                        10)
+            | rpp::ops::as_blocking()
+            | rpp::ops::subscribe(mock);
+
+        CHECK(mock.get_total_on_next_count() == 0);
+        CHECK(mock.get_on_error_count() == 1);
+        CHECK(mock.get_on_completed_count() == 0);
+    }
+}
+
+TEST_CASE("parallel_reduce disposes upstream on error")
+{
+    auto   mock = mock_observer_strategy<int>{};
+    size_t emitted{};
+
+    rpp::source::create<int>([&](const auto& obs) {
+        for (int v = 0; v < 10 && !obs.is_disposed(); ++v)
+        {
+            ++emitted;
+            obs.on_next(v);
+        }
+        obs.on_completed();
+    })
+        | rpp::ops::parallel_reduce(0, [](int s, int v) {
+              if (v == 3)
+                  throw std::runtime_error{"error"};
+              return s + v;
+          },
+                                    std::plus<int>{},
+                                    rpp::schedulers::immediate{},
+                                    2)
+        | rpp::ops::subscribe(mock);
+
+    CHECK(emitted == 4);
+    CHECK(mock.get_total_on_next_count() == 0);
+    CHECK(mock.get_on_error_count() == 1);
+    CHECK(mock.get_on_completed_count() == 0);
+}
+
+TEST_CASE("parallel_reduce satisfies disposable contracts")
+{
+    test_operator_with_disposable<int>(rpp::ops::parallel_reduce(0, std::plus<int>{}, std::plus<int>{}, rpp::schedulers::immediate{}, 2));
+}
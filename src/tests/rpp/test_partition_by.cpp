@@ -0,0 +1,98 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#include <doctest/doctest.h>
+
+#include <rpp/observers/mock_observer.hpp>
+#include <rpp/operators/as_blocking.hpp>
+#include <rpp/operators/partition_by.hpp>
+#include <rpp/schedulers/immediate.hpp>
+#include <rpp/schedulers/thread_pool.hpp>
+#include <rpp/sources/from.hpp>
+#include <rpp/sources/just.hpp>
+
+#include "disposable_observable.hpp"
+
+#include <map>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+TEST_CASE("partition_by processes items by lanes keeping order per key")
+{
+    auto mock = mock_observer_strategy<std::pair<int, int>>{};
+
+    std::vector<std::pair<int, int>> values{};
+    for (int i = 0; i < 1000; ++i)
+        values.emplace_back(i % 7, i);
+
+    SUBCASE("thread_pool with amount of lanes less than keys")
+    {
+        rpp::source::from_iterable(values)
+            | rpp::ops::partition_by([](const std::pair<int, int>& v) { return v.first; },
+                                     3,
+                                     rpp::schedulers::thread_pool{3},
+                                     [](std::pair<int, int> v) { return std::pair{v.first, v.second * 10}; },
+                                     4)
+            | rpp::ops::as_blocking()
+            | rpp::ops::subscribe(mock);
+
+        const auto received = mock.get_received_values();
+        REQUIRE(received.size() == values.size());
+
+        std::map<int, int> last_per_key{};
+        bool               ordered = true;
+        for (const auto& [key, value] : received)
+        {
+            const auto it = last_per_key.find(key);
+            if (it != last_per_key.end() && it->second >= value)
+                ordered = false;
+            last_per_key[key] = value;
+        }
+        CHECK(ordered);
+        CHECK(last_per_key.size() == 7);
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+
+    SUBCASE("immediate scheduler keeps original order")
+    {
+        rpp::source::just(std::pair{1, 1}, std::pair{2, 2}, std::pair{1, 3})
+            | rpp::ops::partition_by([](const std::pair<int, int>& v) { return v.first; }, 2, rpp::schedulers::immediate{}, [](std::pair<int, int> v) { return v; })
+            | rpp::ops::subscribe(mock);
+
+        CHECK(mock.get_received_values() == std::vector{std::pair{1, 1}, std::pair{2, 2}, std::pair{1, 3}});
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+}
+
+TEST_CASE("partition_by forwards error thrown by function")
+{
+    auto mock = mock_observer_strategy<int>{};
+
+    rpp::source::just(1, 2, 3, 4, 5, 6)
+        | rpp::ops::partition_by([](int v) { return v; },
+                                 2,
+                                 rpp::schedulers::thread_pool{2},
+                                 [](int v) {
+                                     if (v == 3)
+                                         throw std::runtime_error{"error"};
+                                     return v;
+                                 })
+        | rpp::ops::as_blocking()
+        | rpp::ops::subscribe(mock);
+
+    CHECK(mock.get_on_error_count() == 1);
+    CHECK(mock.get_on_completed_count() == 0);
+}
+
+TEST_CASE("partition_by satisfies disposable contracts")
+{
+    test_operator_with_disposable<int>(rpp::ops::partition_by([](int v) { return v; }, 2, rpp::schedulers::immediate{}, [](int v) { return v; }, 2));
+}
@@ -0,0 +1,103 @@
+//                  ReactivePlusPlus library
+//
+//          Copyright Aleksey Loginov 2023 - present.
+// Distributed under the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE_1_0.txt or copy at
+//          https://www.boost.org/LICENSE_1_0.txt)
+//
+// Project home: https://github.com/victimsnino/ReactivePlusPlus
+//
+
+#include <doctest/doctest.h>
+
+#include <rpp/observers/mock_observer.hpp>
+#include <rpp/operators/sliding_aggregate.hpp>
+#include <rpp/sources/just.hpp>
+#include <rpp/subjects/publish_subject.hpp>
+
+#include "disposable_observable.hpp"
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST_CASE("sliding_aggregate emits aggregate of last items for each emission")
+{
+    auto obs = rpp::source::just(3, 1, 4, 1, 5, 9, 2, 6);
+
+    SUBCASE("invertible monoid over last 3 items")
+    {
+        auto mock = mock_observer_strategy<int>{};
+        obs | rpp::ops::sliding_aggregate(rpp::ops::sliding_window{3}, rpp::ops::monoids::sum<int>{}) | rpp::ops::subscribe(mock);
+
+        CHECK(mock.get_received_values() == std::vector{3, 4, 8, 6, 10, 15, 16, 17});
+        CHECK(mock.get_on_completed_count() == 1);
+    }
+
+    SUBCASE("count monoid over last 3 items")
+    {
+        auto mock = mock_observer_strategy<size_t>{};
+        obs | rpp::ops::sliding_aggregate(rpp::ops::sliding_window{3}, rpp::ops::monoids::count{}) | rpp::ops::subscribe(mock);
+
+        CHECK(mock.get_received_values() == std::vector<size_t>{1, 2, 3, 3, 3, 3, 3, 3});
+    }
+
+    SUBCASE("non-invertible monoids over last 3 items")
+    {
+        auto min = mock_observer_strategy<int>{};
+        obs | rpp::ops::sliding_aggregate(rpp::ops::sliding_window{3}, rpp::ops::monoids::min<int>{}) | rpp::ops::subscribe(min);
+        CHECK(min.get_received_values() == std::vector{3, 1, 1, 1, 1, 1, 2, 2});
+
+        auto max = mock_observer_strategy<int>{};
+        obs | rpp::ops::sliding_aggregate(rpp::ops::sliding_window{3}, rpp::ops::monoids::max<int>{}) | rpp::ops::subscribe(max);
+        CHECK(max.get_received_values() == std::vector{3, 3, 4, 4, 5, 9, 9, 9});
+    }
+
+    SUBCASE("non-commutative monoid keeps order of items")
+    {
+        struct concat
+        {
+            std::string identity() const { return {}; }
+            std::string combine(const std::string& lhs, const std::string& rhs) const { return lhs + rhs; }
+            std::string lift(int v) const { return std::to_string(v); }
+        };
+
+        auto mock = mock_observer_strategy<std::string>{};
+        obs | rpp::ops::sliding_aggregate(rpp::ops::sliding_window{3}, concat{}) | rpp::ops::subscribe(mock);
+
+        CHECK(mock.get_received_values() == std::vector<std::string>{"3", "31", "314", "141", "415", "159", "592", "926"});
+    }
+
+    SUBCASE("unbounded window aggregates all items")
+    {
+        auto mock = mock_observer_strategy<int>{};
+        obs | rpp::ops::sliding_aggregate(rpp::ops::sliding_window{}, rpp::ops::monoids::max<int>{}) | rpp::ops::subscribe(mock);
+
+        CHECK(mock.get_received_values() == std::vector{3, 3, 4, 4, 5, 9, 9, 9});
+    }
+}
+
+TEST_CASE("sliding_aggregate evicts items older than duration")
+{
+    rpp::subjects::publish_subject<int> subj{};
+
+    auto sum = mock_observer_strategy<int>{};
+    auto min = mock_observer_strategy<int>{};
+    subj.get_observable() | rpp::ops::sliding_aggregate(rpp::ops::sliding_window{.duration = std::chrono::milliseconds{50}}, rpp::ops::monoids::sum<int>{}) | rpp::ops::subscribe(sum);
+    subj.get_observable() | rpp::ops::sliding_aggregate(rpp::ops::sliding_window{.duration = std::chrono::milliseconds{50}}, rpp::ops::monoids::min<int>{}) | rpp::ops::subscribe(min);
+
+    subj.get_observer().on_next(1);
+    subj.get_observer().on_next(2);
+    std::this_thread::sleep_for(std::chrono::milliseconds{100});
+    subj.get_observer().on_next(3);
+    subj.get_observer().on_next(4);
+
+    CHECK(sum.get_received_values() == std::vector{1, 3, 3, 7});
+    CHECK(min.get_received_values() == std::vector{1, 1, 3, 3});
+}
+
+TEST_CASE("sliding_aggregate satisfies disposable contracts")
+{
+    test_operator_with_disposable<int>(rpp::ops::sliding_aggregate(rpp::ops::sliding_window{2}, rpp::ops::monoids::sum<int>{}));
+}
@@ -13,16 +13,63 @@
 #include <rpp/disposables/composite_disposable.hpp>
 #include <rpp/observers/mock_observer.hpp>
 #include <rpp/operators/as_blocking.hpp>
+#include <rpp/operators/take.hpp>
 #include <rpp/sources/create.hpp>
+#include <rpp/schedulers/immediate.hpp>
+#include <rpp/schedulers/thread_pool.hpp>
 #include <rpp/subjects/behavior_subject.hpp>
+#include <rpp/subjects/buffered_subject.hpp>
+#include <rpp/subjects/fanout_subject.hpp>
 #include <rpp/subjects/publish_subject.hpp>
 #include <rpp/subjects/replay_subject.hpp>
+#include <rpp/subjects/spilling_replay_subject.hpp>
 
 #include "copy_count_tracker.hpp"
 #include "rpp_trompeloil.hpp"
 
+#include <deque>
+#include <filesystem>
+#include <limits>
+#include <stdexcept>
+#include <string>
 #include <thread>
 
+namespace
+{
+    class manual_scheduler final
+    {
+    public:
+        class worker_strategy
+        {
+        public:
+            inline static rpp::schedulers::details::schedulables_queue<worker_strategy> s_test_queue{};
+            template<rpp::schedulers::constraint::schedulable_handler Handler, typename... Args, rpp::schedulers::constraint::schedulable_fn<Handler, Args...> Fn>
+            void defer_for(rpp::schedulers::duration duration, Fn&& fn, Handler&& handler, Args&&... args) const
+            {
+                s_test_queue.emplace(rpp::schedulers::time_point{duration}, std::forward<Fn>(fn), std::forward<Handler>(handler), std::forward<Args>(args)...);
+            }
+
+            static rpp::schedulers::time_point now() { return rpp::schedulers::clock_type::now(); }
+        };
+
+        static rpp::schedulers::worker<worker_strategy> create_worker()
+        {
+            return rpp::schedulers::worker<worker_strategy>{};
+        }
+
+        static void drain()
+        {
+            while (!worker_strategy::s_test_queue.is_empty())
+            {
+                auto fn = worker_strategy::s_test_queue.top();
+                worker_strategy::s_test_queue.pop();
+                if (!fn->is_disposed())
+                    (*fn)();
+            }
+        }
+    };
+} // namespace
+
 TEST_CASE("publish subject multicasts values")
 {
     auto mock_1 = mock_observer_strategy<int>{};
@@ -150,7 +197,7 @@ TEST_CASE("subject can be modified from on_next call")
 
         subject.get_observer().on_next(1);
 
-        REQUIRE_CALL(*inner_mock, on_next_lvalue(2));
+        REQUIRE_CALL(*inner_mock, on_next_rvalue(2));
         subject.get_observer().on_next(2);
     }
 
@@ -163,7 +210,7 @@ TEST_CASE("subject can be modified from on_next call")
         });
         subject.get_observable().subscribe(d, inner_mock);
 
-        REQUIRE_CALL(*inner_mock, on_next_lvalue(1));
+        REQUIRE_CALL(*inner_mock, on_next_rvalue(1));
         subject.get_observer().on_next(1);
         subject.get_observer().on_next(2);
     }
@@ -189,6 +236,98 @@ TEST_CASE("subject handles addition from inside on_next properly")
     }
 }
 
+TEST_CASE("subject keeps proper observers after many subscriptions and unsubscriptions")
+{
+    rpp::subjects::publish_subject<int> subject{};
+
+    std::vector<int>                               received(100);
+    std::vector<rpp::composite_disposable_wrapper> disposables{};
+    for (size_t i = 0; i < received.size(); ++i)
+        disposables.push_back(subject.get_observable().subscribe_with_disposable([&received, i](int v) { received[i] += v; }));
+
+    for (size_t i = 0; i < received.size(); i += 2)
+        disposables[i].dispose();
+
+    subject.get_observer().on_next(1);
+
+    SUBCASE("only alive observers obtain value")
+    {
+        for (size_t i = 0; i < received.size(); ++i)
+            CHECK(received[i] == (i % 2 == 0 ? 0 : 1));
+    }
+
+    SUBCASE("new observers obtain values after compaction")
+    {
+        for (size_t i = 1; i < received.size(); i += 2)
+            disposables[i].dispose();
+
+        int last{};
+        subject.get_observable().subscribe([&last](int v) { last = v; });
+        subject.get_observer().on_next(2);
+
+        CHECK(last == 2);
+        for (size_t i = 0; i < received.size(); ++i)
+            CHECK(received[i] == (i % 2 == 0 ? 0 : 1));
+    }
+}
+
+TEST_CASE("subject observers are reclaimed while some reader is always active")
+{
+    using observers_list = rpp::subjects::details::subject_observers<int>;
+
+    const auto make_observer = [](std::shared_ptr<int> token) -> observers_list::observer {
+        auto observer = rpp::make_lambda_observer<int>([token](int) {});
+        return std::make_shared<rpp::details::observers::type_erased_observer<decltype(observer)>>(std::move(observer));
+    };
+
+    observers_list                           observers{};
+    std::deque<observers_list::removal_mark> marks(1);
+    observers.add(make_observer({}), &marks.front());
+
+    // each reader stays inside of emission till it is released, next reader starts before previous one is released
+    std::atomic<size_t> entered{};
+    std::atomic<size_t> released{};
+    const auto          start_reader = [&](size_t index) {
+        std::thread reader{[&, index] {
+            observers.for_each([](const auto&) {},
+                               [&](const auto&) {
+                                   entered.store(index);
+                                   while (released.load() < index)
+                                       std::this_thread::yield();
+                               });
+        }};
+        while (entered.load() < index)
+            std::this_thread::yield();
+        return reader;
+    };
+
+    std::vector<std::weak_ptr<int>> tokens{};
+    std::thread                     previous = start_reader(1);
+    for (size_t i = 2; i < 100; ++i)
+    {
+        std::thread current = start_reader(i);
+        released.store(i - 1);
+        previous.join();
+        previous = std::move(current);
+
+        auto token = std::make_shared<int>();
+        tokens.push_back(token);
+        observers.add(make_observer(std::move(token)), &marks.emplace_back());
+        observers.remove(marks.back());
+
+        CHECK(observers.retired_count() <= 2);
+        if (tokens.size() > 2)
+            CHECK(tokens[tokens.size() - 3].expired());
+    }
+
+    released.store(std::numeric_limits<size_t>::max());
+    previous.join();
+
+    CHECK(observers.retired_count() == 0);
+    for (const auto& token : tokens)
+        CHECK(token.expired());
+}
+
 TEST_CASE("publish subject caches error/completed")
 {
     auto mock = mock_observer_strategy<int>{};
@@ -314,6 +453,67 @@ TEST_CASE_TEMPLATE("serialized subjects handles race condition", TestType, rpp::
     }
 }
 
+TEST_CASE("serialized_publish_subject serializes emissions from multiple threads")
+{
+    rpp::subjects::serialized_publish_subject<int> subj{};
+
+    constexpr int threads_count = 4;
+    constexpr int values_count  = 1000;
+
+    std::atomic_bool in_on_next{};
+    bool             overlapped{};
+    std::vector<int> last_values(threads_count, -1);
+    bool             ordered{true};
+    size_t           total{};
+    size_t           completed{};
+    subj.get_observable().subscribe(
+        [&](int v) {
+            if (in_on_next.exchange(true))
+                overlapped = true;
+
+            const auto thread   = static_cast<size_t>(v / values_count);
+            ordered             = ordered && last_values[thread] < v;
+            last_values[thread] = v;
+            ++total;
+
+            in_on_next.store(false);
+        },
+        [&]() { ++completed; });
+
+    std::vector<std::thread> threads{};
+    for (int t = 0; t < threads_count; ++t)
+    {
+        threads.emplace_back([&, t] {
+            for (int i = 0; i < values_count; ++i)
+                subj.get_observer().on_next(t * values_count + i);
+        });
+    }
+    for (auto& t : threads)
+        t.join();
+    subj.get_observer().on_completed();
+
+    CHECK_FALSE(overlapped);
+    CHECK(ordered);
+    CHECK(total == threads_count * values_count);
+    CHECK(completed == 1);
+}
+
+TEST_CASE("serialized_publish_subject allows emission from inside on_next")
+{
+    rpp::subjects::serialized_publish_subject<int> subj{};
+    auto                                           mock = mock_observer_strategy<int>{};
+
+    subj.get_observable().subscribe([&subj](int v) {
+        if (v == 1)
+            subj.get_observer().on_next(2);
+    });
+    subj.get_observable().subscribe(mock);
+
+    subj.get_observer().on_next(1);
+
+    CHECK(mock.get_received_values() == std::vector{1, 2});
+}
+
 TEST_CASE_TEMPLATE("replay subject multicasts values and replay", TestType, rpp::subjects::replay_subject<int>, rpp::subjects::serialized_replay_subject<int>)
 {
     SUBCASE("replay subject")
@@ -408,6 +608,61 @@ TEST_CASE_TEMPLATE("replay subject multicasts values and replay", TestType, rpp:
         }
     }
 
+    SUBCASE("bounded replay subject with many values")
+    {
+        auto mock = mock_observer_strategy<int>{};
+
+        auto sub = TestType{size_t{100}};
+
+        std::vector<int> expected{};
+        for (int i = 0; i < 1000; ++i)
+        {
+            sub.get_observer().on_next(i);
+            if (i >= 900)
+                expected.push_back(i);
+        }
+
+        SUBCASE("observer obtains only last values")
+        {
+            sub.get_observable().subscribe(mock.get_observer());
+            CHECK(mock.get_received_values() == expected);
+        }
+
+        SUBCASE("observer obtains snapshot even if new values emitted during replay")
+        {
+            bool       emitted{};
+            const auto obs = sub.get_observer();
+            sub.get_observable().subscribe([&](int v) {
+                mock.on_next(v);
+                if (!std::exchange(emitted, true))
+                {
+                    for (int i = 1000; i < 1200; ++i)
+                        obs.on_next(i);
+                }
+            });
+            CHECK(mock.get_received_values() == expected);
+        }
+
+        SUBCASE("observer replays consistent values while other thread emits")
+        {
+            std::thread th{[obs = sub.get_observer()] {
+                for (int i = 1000; i < 20000; ++i)
+                    obs.on_next(i);
+            }};
+
+            for (size_t i = 0; i < 100; ++i)
+            {
+                std::vector<int> replayed{};
+                sub.get_observable() | rpp::ops::take(100) | rpp::ops::subscribe([&replayed](int v) { replayed.push_back(v); });
+
+                REQUIRE(replayed.size() == 100);
+                for (size_t j = 1; j < replayed.size(); ++j)
+                    CHECK(replayed[j] == replayed[j - 1] + 1);
+            }
+            th.join();
+        }
+    }
+
     SUBCASE("bounded replay subject with duration")
     {
         using namespace std::chrono_literals;
@@ -450,6 +705,45 @@ TEST_CASE_TEMPLATE("replay subject multicasts values and replay", TestType, rpp:
     }
 }
 
+TEST_CASE_TEMPLATE("publish subject moves value into the last observer", TestType, rpp::subjects::publish_subject<copy_count_tracker>, rpp::subjects::serialized_publish_subject<copy_count_tracker>)
+{
+    auto sub = TestType{};
+
+    SUBCASE("single observer obtains moved value")
+    {
+        sub.get_observable().subscribe([](copy_count_tracker tracker) { // NOLINT
+            CHECK(tracker.get_copy_count() == 0);
+            CHECK(tracker.get_move_count() == 1);
+        });
+
+        sub.get_observer().on_next(copy_count_tracker{});
+    }
+
+    SUBCASE("only last observer obtains moved value")
+    {
+        sub.get_observable().subscribe([](copy_count_tracker tracker) { // NOLINT
+            CHECK(tracker.get_copy_count() == 1);                       // 1 copy to this observer
+            CHECK(tracker.get_move_count() == 0);
+        });
+        sub.get_observable().subscribe([](copy_count_tracker tracker) { // NOLINT
+            CHECK(tracker.get_copy_count() == 1);
+            CHECK(tracker.get_move_count() == 1);                       // 1 move to this observer
+        });
+
+        sub.get_observer().on_next(copy_count_tracker{});
+    }
+
+    SUBCASE("lvalue is copied to each observer")
+    {
+        copy_count_tracker tracker{};
+        sub.get_observable().subscribe([](const copy_count_tracker&) {});
+        sub.get_observable().subscribe([](copy_count_tracker) {}); // NOLINT
+
+        sub.get_observer().on_next(tracker);
+        CHECK(tracker.get_move_count() == 0);
+    }
+}
+
 TEST_CASE_TEMPLATE("replay subject doesn't introduce additional copies", TestType, rpp::subjects::replay_subject<copy_count_tracker>, rpp::subjects::serialized_replay_subject<copy_count_tracker>)
 {
     SUBCASE("on_next by rvalue")
@@ -457,15 +751,15 @@ TEST_CASE_TEMPLATE("replay subject doesn't introduce additional copies", TestTyp
         auto sub = TestType{};
 
         sub.get_observable().subscribe([](copy_count_tracker tracker) { // NOLINT
-            CHECK(tracker.get_copy_count() == 2);                       // 1 copy to internal replay buffer + 1 copy to this observer
-            CHECK(tracker.get_move_count() == 0);
+            CHECK(tracker.get_copy_count() == 1);                       // 1 copy to internal replay buffer
+            CHECK(tracker.get_move_count() == 1);                       // 1 move to this observer
         });
 
         sub.get_observer().on_next(copy_count_tracker{});
 
         sub.get_observable().subscribe([](copy_count_tracker tracker) { // NOLINT
-            CHECK(tracker.get_copy_count() == 2 + 1);                   // + 1 copy values from buffer for this observer
-            CHECK(tracker.get_move_count() == 0 + 1);                   // + 1 move to this observer
+            CHECK(tracker.get_copy_count() == 1 + 1);                   // + 1 copy from buffer to this observer
+            CHECK(tracker.get_move_count() == 1);
         });
     }
 
@@ -482,12 +776,130 @@ TEST_CASE_TEMPLATE("replay subject doesn't introduce additional copies", TestTyp
         sub.get_observer().on_next(tracker);
 
         sub.get_observable().subscribe([](copy_count_tracker tracker) { // NOLINT
-            CHECK(tracker.get_copy_count() == 2 + 1);                   // + 1 copy values from buffer for this observer
-            CHECK(tracker.get_move_count() == 0 + 1);                   // + 1 move to this observer
+            CHECK(tracker.get_copy_count() == 2 + 1);                   // + 1 copy from buffer to this observer
+            CHECK(tracker.get_move_count() == 0);
         });
     }
 }
 
+namespace
+{
+    struct string_serializer
+    {
+        void serialize(const std::string& v, std::vector<std::byte>& out) const
+        {
+            const auto* begin = reinterpret_cast<const std::byte*>(v.data());
+            out.insert(out.end(), begin, begin + v.size());
+        }
+
+        std::string deserialize(std::span<const std::byte> bytes) const
+        {
+            return std::string{reinterpret_cast<const char*>(bytes.data()), bytes.size()};
+        }
+    };
+} // namespace
+
+TEST_CASE_TEMPLATE("spilling replay subject replays spilled and hot values", TestType, rpp::subjects::spilling_replay_subject<std::string, string_serializer>, rpp::subjects::serialized_spilling_replay_subject<std::string, string_serializer>)
+{
+    const auto path = std::filesystem::temp_directory_path() / "rpp_spilling_replay_subject_test.bin";
+
+    {
+        auto       subj = TestType{path, 2, string_serializer{}, 1};
+        const auto obs  = subj.get_observer();
+        CHECK(std::filesystem::exists(path));
+
+        SUBCASE("observer obtains all values in order")
+        {
+            std::vector<std::string> expected{};
+            for (size_t i = 0; i < 100; ++i)
+            {
+                // values of different sizes, some of them larger than chunk
+                expected.push_back(std::string(i * 97, 'a') + std::to_string(i));
+                obs.on_next(expected.back());
+            }
+
+            auto mock = mock_observer_strategy<std::string>{};
+            subj.get_observable().subscribe(mock);
+            CHECK(mock.get_received_values() == expected);
+
+            SUBCASE("observer obtains new values after replay")
+            {
+                obs.on_next("new");
+                obs.on_completed();
+
+                CHECK(mock.get_received_values().back() == "new");
+                CHECK(mock.get_on_completed_count() == 1);
+            }
+        }
+
+        SUBCASE("empty values are spilled too")
+        {
+            for (size_t i = 0; i < 5; ++i)
+                obs.on_next("");
+
+            auto mock = mock_observer_strategy<std::string>{};
+            subj.get_observable().subscribe(mock);
+            CHECK(mock.get_received_values() == std::vector<std::string>(5));
+        }
+
+        SUBCASE("observer obtains snapshot even if new values emitted during replay")
+        {
+            for (size_t i = 0; i < 10; ++i)
+                obs.on_next(std::to_string(i));
+
+            auto mock = mock_observer_strategy<std::string>{};
+            bool emitted{};
+            subj.get_observable().subscribe([&](const std::string& v) {
+                mock.on_next(v);
+                if (!std::exchange(emitted, true))
+                {
+                    for (size_t i = 10; i < 20; ++i)
+                        obs.on_next(std::to_string(i));
+                }
+            });
+            CHECK(mock.get_received_values().size() == 10);
+            CHECK(mock.get_received_values().back() == "9");
+        }
+    }
+
+    CHECK(!std::filesystem::exists(path));
+}
+
+TEST_CASE("spilling replay subject emits failure of spilling as on_error and keeps replay consistent")
+{
+    struct throwing_serializer : string_serializer
+    {
+        void serialize(const std::string& v, std::vector<std::byte>& out) const
+        {
+            if (v == "bad")
+                throw std::runtime_error{"can't serialize"};
+            string_serializer::serialize(v, out);
+        }
+    };
+
+    const auto path = std::filesystem::temp_directory_path() / "rpp_spilling_replay_subject_failure_test.bin";
+
+    auto       subj = rpp::subjects::spilling_replay_subject<std::string, throwing_serializer>{path, 1, throwing_serializer{}};
+    const auto obs  = subj.get_observer();
+
+    auto mock = mock_observer_strategy<std::string>{};
+    subj.get_observable().subscribe(mock);
+
+    obs.on_next("a");
+    obs.on_next("bad");
+    // "bad" is spilled to free place for "c"
+    obs.on_next("c");
+    obs.on_next("d");
+
+    CHECK(mock.get_received_values() == std::vector<std::string>{"a", "bad"});
+    CHECK(mock.get_on_error_count() == 1);
+
+    auto late_mock = mock_observer_strategy<std::string>{};
+    subj.get_observable().subscribe(late_mock);
+    CHECK(late_mock.get_received_values() == std::vector<std::string>{"a", "bad"});
+    CHECK(late_mock.get_on_error_count() == 1);
+}
+
 TEST_CASE_TEMPLATE("replay subject multicasts values and replay", TestType, rpp::subjects::behavior_subject<int>, rpp::subjects::serialized_behavior_subject<int>)
 {
     const auto mock_1 = mock_observer_strategy<int>{};
@@ -544,3 +956,238 @@ TEST_CASE_TEMPLATE("replay subject multicasts values and replay", TestType, rpp:
         }
     }
 }
+
+TEST_CASE("behavior subject provides consistent value to concurrent readers")
+{
+    struct triple
+    {
+        size_t first;
+        size_t second;
+        size_t third;
+    };
+
+    auto subj = rpp::subjects::serialized_behavior_subject<triple>{triple{0, 0, 0}};
+
+    std::atomic_bool         stop{};
+    std::atomic_bool         torn{};
+    std::vector<std::thread> readers{};
+    for (size_t i = 0; i < 4; ++i)
+    {
+        readers.emplace_back([&] {
+            while (!stop.load())
+            {
+                const auto v = subj.get_value();
+                if (v.first != v.second || v.second != v.third)
+                    torn.store(true);
+            }
+        });
+    }
+
+    const auto obs = subj.get_observer();
+    for (size_t i = 1; i <= 100000; ++i)
+        obs.on_next(triple{i, i, i});
+
+    stop.store(true);
+    for (auto& t : readers)
+        t.join();
+
+    CHECK(!torn.load());
+    CHECK(subj.get_value().first == 100000);
+}
+
+TEST_CASE("behavior subject keeps non-trivially copyable value")
+{
+    auto subj = rpp::subjects::behavior_subject<std::string>{"initial"};
+    CHECK(subj.get_value() == "initial");
+
+    subj.get_observer().on_next("updated");
+    CHECK(subj.get_value() == "updated");
+
+    auto mock = mock_observer_strategy<std::string>{};
+    subj.get_observable().subscribe(mock);
+    CHECK(mock.get_received_values() == std::vector<std::string>{"updated"});
+}
+
+TEST_CASE("fanout subject multicasts values to all shards")
+{
+    auto subj = rpp::subjects::fanout_subject<int, rpp::schedulers::immediate>{rpp::schedulers::immediate{}, 3};
+
+    std::vector<mock_observer_strategy<int>> mocks(5);
+    for (const auto& mock : mocks)
+        subj.get_observable().subscribe(mock);
+
+    SUBCASE("each observer obtains each value")
+    {
+        subj.get_observer().on_next(1);
+        subj.get_observer().on_next(2);
+
+        for (const auto& mock : mocks)
+            CHECK(mock.get_received_values() == std::vector{1, 2});
+
+        SUBCASE("each observer obtains completion and new observer obtains completion too")
+        {
+            subj.get_observer().on_completed();
+            for (const auto& mock : mocks)
+                CHECK(mock.get_on_completed_count() == 1);
+
+            auto late = mock_observer_strategy<int>{};
+            subj.get_observable().subscribe(late);
+            CHECK(late.get_on_completed_count() == 1);
+        }
+    }
+
+    SUBCASE("each observer obtains error")
+    {
+        subj.get_observer().on_error({});
+        for (const auto& mock : mocks)
+            CHECK(mock.get_on_error_count() == 1);
+    }
+
+    SUBCASE("disposed subject emits nothing")
+    {
+        subj.get_disposable().dispose();
+        subj.get_observer().on_next(1);
+        for (const auto& mock : mocks)
+            CHECK(mock.get_received_values().empty());
+    }
+}
+
+TEST_CASE("fanout subject is disposed by terminal event but delivers queued emissions")
+{
+    manual_scheduler::worker_strategy::s_test_queue = {};
+
+    auto subj = rpp::subjects::fanout_subject<int, manual_scheduler>{manual_scheduler{}, 2};
+
+    std::vector<mock_observer_strategy<int>> mocks(3);
+    for (const auto& mock : mocks)
+        subj.get_observable().subscribe(mock);
+
+    const auto upstream = rpp::composite_disposable_wrapper::make();
+    auto       obs      = subj.get_observer();
+    obs.set_upstream(upstream);
+
+    obs.on_next(1);
+
+    SUBCASE("on_completed")
+    {
+        obs.on_completed();
+
+        CHECK(subj.get_disposable().is_disposed());
+        CHECK(upstream.is_disposed());
+
+        manual_scheduler::drain();
+        for (const auto& mock : mocks)
+        {
+            CHECK(mock.get_received_values() == std::vector{1});
+            CHECK(mock.get_on_completed_count() == 1);
+        }
+    }
+
+    SUBCASE("on_error")
+    {
+        obs.on_error({});
+
+        CHECK(subj.get_disposable().is_disposed());
+        CHECK(upstream.is_disposed());
+
+        manual_scheduler::drain();
+        for (const auto& mock : mocks)
+        {
+            CHECK(mock.get_received_values() == std::vector{1});
+            CHECK(mock.get_on_error_count() == 1);
+        }
+    }
+}
+
+TEST_CASE("fanout subject preserves order per subscriber on thread_pool")
+{
+    auto subj = rpp::subjects::fanout_subject<int, rpp::schedulers::thread_pool>{rpp::schedulers::thread_pool{4}, 4};
+
+    constexpr size_t              subscribers_count = 16;
+    std::vector<std::vector<int>> received(subscribers_count);
+    std::atomic<size_t>           completed_count{};
+    for (auto& values : received)
+    {
+        subj.get_observable().subscribe([&values](int v) { values.push_back(v); },
+                                        [&completed_count] { completed_count.fetch_add(1); });
+    }
+
+    std::vector<int> expected{};
+    const auto       obs = subj.get_observer();
+    for (int i = 0; i < 1000; ++i)
+    {
+        expected.push_back(i);
+        obs.on_next(i);
+    }
+    obs.on_completed();
+
+    while (completed_count.load() != subscribers_count)
+        std::this_thread::yield();
+
+    for (const auto& values : received)
+        CHECK(values == expected);
+}
+
+TEST_CASE("buffered subject isolates slow subscribers")
+{
+    manual_scheduler::worker_strategy::s_test_queue = {};
+
+    auto subj = rpp::subjects::buffered_subject<int, manual_scheduler>{manual_scheduler{}, 2};
+
+    auto drop_newest = mock_observer_strategy<int>{};
+    auto conflate    = mock_observer_strategy<int>{};
+    auto disconnect  = mock_observer_strategy<int>{};
+    auto lag         = std::make_shared<rpp::subjects::subscriber_lag>();
+    auto error_lag   = std::make_shared<rpp::subjects::subscriber_lag>();
+
+    subj.get_observable(2, rpp::operators::backpressure_overflow::DropNewest, lag).subscribe(drop_newest);
+    subj.get_observable(2, rpp::operators::backpressure_overflow::DropOldest).subscribe(conflate);
+    subj.get_observable(2, rpp::operators::backpressure_overflow::Error, error_lag).subscribe(disconnect);
+
+    const auto obs = subj.get_observer();
+    for (int i = 1; i <= 5; ++i)
+        obs.on_next(i);
+
+    SUBCASE("producer is not blocked and lag is tracked")
+    {
+        CHECK(drop_newest.get_received_values().empty());
+        CHECK(lag->received.load() == 5);
+        CHECK(lag->dropped.load() == 3);
+        CHECK(lag->pending() == 2);
+        CHECK(error_lag->received.load() == 3);
+        CHECK(error_lag->pending() == 3);
+    }
+
+    manual_scheduler::drain();
+
+    SUBCASE("each subscriber obtains values according to its policy")
+    {
+        CHECK(drop_newest.get_received_values() == std::vector{1, 2});
+        CHECK(conflate.get_received_values() == std::vector{4, 5});
+        CHECK(disconnect.get_received_values().empty());
+        CHECK(disconnect.get_on_error_count() == 1);
+        CHECK(lag->delivered.load() == 2);
+        CHECK(lag->pending() == 0);
+    }
+
+    SUBCASE("values discarded by overflow error are counted as dropped")
+    {
+        CHECK(error_lag->received.load() == 3);
+        CHECK(error_lag->delivered.load() == 0);
+        CHECK(error_lag->dropped.load() == 3);
+        CHECK(error_lag->pending() == 0);
+    }
+
+    SUBCASE("disconnected subscriber doesn't obtain new values")
+    {
+        obs.on_next(6);
+        obs.on_completed();
+        manual_scheduler::drain();
+
+        CHECK(drop_newest.get_received_values() == std::vector{1, 2, 6});
+        CHECK(conflate.get_received_values() == std::vector{4, 5, 6});
+        CHECK(disconnect.get_received_values().empty());
+        CHECK(drop_newest.get_on_completed_count() == 1);
+        CHECK(disconnect.get_on_completed_count() == 0);
+    }
+}
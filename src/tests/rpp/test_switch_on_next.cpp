@@ -109,7 +109,7 @@ TEST_CASE("switch_on_next switches observable after obtaining new one")
 
                 SUBCASE("Only value from first subject obtained")
                 {
-                    REQUIRE_CALL(*mock, on_next_lvalue(1)).IN_SEQUENCE(s);
+                    REQUIRE_CALL(*mock, on_next_rvalue(1)).IN_SEQUENCE(s);
                     subj_1.get_observer().on_next(1);
                     subj_2.get_observer().on_next(2);
                 }
@@ -121,7 +121,7 @@ TEST_CASE("switch_on_next switches observable after obtaining new one")
                     {
                         subj_1.get_observer().on_next(1);
 
-                        REQUIRE_CALL(*mock, on_next_lvalue(2)).IN_SEQUENCE(s);
+                        REQUIRE_CALL(*mock, on_next_rvalue(2)).IN_SEQUENCE(s);
                         subj_2.get_observer().on_next(2);
                     }
                 }
@@ -129,7 +129,7 @@ TEST_CASE("switch_on_next switches observable after obtaining new one")
                 {
                     subj_of_subjects.get_observer().on_completed();
 
-                    REQUIRE_CALL(*mock, on_next_lvalue(1)).IN_SEQUENCE(s);
+                    REQUIRE_CALL(*mock, on_next_rvalue(1)).IN_SEQUENCE(s);
                     subj_1.get_observer().on_next(1);
                     subj_2.get_observer().on_next(2);
                     SUBCASE("subject sends on_completed")
@@ -12,12 +12,15 @@
 
 #include <rpp/observers/mock_observer.hpp>
 #include <rpp/operators/window.hpp>
+#include <rpp/schedulers/test_scheduler.hpp>
 #include <rpp/sources/error.hpp>
 #include <rpp/sources/just.hpp>
 #include <rpp/subjects/publish_subject.hpp>
 
 #include "disposable_observable.hpp"
 
+#include <vector>
+
 TEST_CASE("window subdivide observable into sub-observables")
 {
     SUBCASE("observable of 3 items with window(2)")
@@ -213,3 +216,127 @@ TEST_CASE("window satisfies disposable contracts")
 {
     test_operator_with_disposable<int>(rpp::ops::window(1));
 }
+
+TEST_CASE("window_with_time opens and closes windows by single timer")
+{
+    rpp::schedulers::test_scheduler     scheduler{};
+    rpp::subjects::publish_subject<int> subj{};
+
+    std::vector<std::vector<int>> windows{};
+    std::vector<bool>             completed{};
+    size_t                        on_completed_count{};
+
+    auto subscribe = [&](auto&& op) {
+        subj.get_observable()
+            | op
+            | rpp::ops::subscribe([&](const rpp::window_observable<int>& window) {
+                  const auto index = windows.size();
+                  windows.emplace_back();
+                  completed.push_back(false);
+                  window.subscribe([&windows, index](int v) { windows[index].push_back(v); },
+                                   [&completed, index]() { completed[index] = true; });
+              },
+                                  [&]() { ++on_completed_count; });
+    };
+
+    SUBCASE("tumbling windows")
+    {
+        subscribe(rpp::ops::window_with_time(std::chrono::seconds{2}, scheduler));
+        CHECK(windows.size() == 1);
+        CHECK(scheduler.get_schedulings().size() == 1);
+
+        subj.get_observer().on_next(1);
+        subj.get_observer().on_next(2);
+        scheduler.time_advance(std::chrono::seconds{2});
+
+        CHECK(windows == std::vector<std::vector<int>>{{1, 2}, {}});
+        CHECK(completed == std::vector{true, false});
+
+        subj.get_observer().on_next(3);
+        scheduler.time_advance(std::chrono::seconds{2});
+        subj.get_observer().on_next(4);
+
+        CHECK(windows == std::vector<std::vector<int>>{{1, 2}, {3}, {4}});
+        CHECK(completed == std::vector{true, true, false});
+
+        SUBCASE("single timer is rescheduled instead of timer per window")
+        {
+            CHECK(scheduler.get_schedulings().size() == 3);
+        }
+
+        SUBCASE("on_completed completes open windows and observer")
+        {
+            subj.get_observer().on_completed();
+            CHECK(completed == std::vector{true, true, true});
+            CHECK(on_completed_count == 1);
+        }
+    }
+
+    SUBCASE("overlapping windows")
+    {
+        subscribe(rpp::ops::window_with_time(std::chrono::seconds{3}, std::chrono::seconds{1}, scheduler));
+
+        subj.get_observer().on_next(1);
+        scheduler.time_advance(std::chrono::seconds{1});
+        subj.get_observer().on_next(2);
+        scheduler.time_advance(std::chrono::seconds{1});
+        subj.get_observer().on_next(3);
+        scheduler.time_advance(std::chrono::seconds{1});
+        subj.get_observer().on_next(4);
+
+        CHECK(windows == std::vector<std::vector<int>>{{1, 2, 3}, {2, 3, 4}, {3, 4}, {4}});
+        CHECK(completed == std::vector{true, false, false, false});
+    }
+
+    SUBCASE("windows with gaps")
+    {
+        subscribe(rpp::ops::window_with_time(std::chrono::seconds{1}, std::chrono::seconds{2}, scheduler));
+
+        subj.get_observer().on_next(1);
+        scheduler.time_advance(std::chrono::seconds{1});
+        subj.get_observer().on_next(2);
+        scheduler.time_advance(std::chrono::seconds{1});
+        subj.get_observer().on_next(3);
+
+        CHECK(windows == std::vector<std::vector<int>>{{1}, {3}});
+        CHECK(completed == std::vector{true, false});
+    }
+
+    SUBCASE("non-positive span is clamped instead of firing timer at the same time forever")
+    {
+        SUBCASE("zero span")
+        {
+            subscribe(rpp::ops::window_with_time(std::chrono::seconds{0}, scheduler));
+        }
+        SUBCASE("negative span and shift")
+        {
+            subscribe(rpp::ops::window_with_time(std::chrono::seconds{-1}, std::chrono::seconds{-1}, scheduler));
+        }
+
+        subj.get_observer().on_next(1);
+        scheduler.time_advance(rpp::schedulers::duration{1});
+        subj.get_observer().on_next(2);
+
+        CHECK(windows == std::vector<std::vector<int>>{{1}, {2}});
+        CHECK(completed == std::vector{true, false});
+    }
+
+    SUBCASE("late timer skips missed openings")
+    {
+        subscribe(rpp::ops::window_with_time(std::chrono::seconds{1}, scheduler));
+
+        scheduler.time_advance(std::chrono::milliseconds{3500});
+        subj.get_observer().on_next(1);
+
+        CHECK(windows == std::vector<std::vector<int>>{{}, {1}});
+        CHECK(completed == std::vector{true, false});
+
+        scheduler.time_advance(std::chrono::milliseconds{500});
+        CHECK(completed == std::vector{true, true, false});
+    }
+}
+
+TEST_CASE("window_with_time satisfies disposable contracts")
+{
+    test_operator_with_disposable<int>(rpp::ops::window_with_time(std::chrono::seconds{1}, rpp::schedulers::test_scheduler{}));
+}
@@ -17,6 +17,12 @@
 
 #include "disposable_observable.hpp"
 
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <string>
+#include <thread>
+
 
 TEST_CASE("with_latest_from combines observables")
 {
@@ -180,6 +186,96 @@ TEST_CASE("with_latest_from handles race condition")
 }
 
 
+TEST_CASE("with_latest_from reads consistent snapshots of values updated from other thread")
+{
+    struct pair
+    {
+        size_t first{};
+        size_t second{};
+    };
+
+    auto source        = rpp::subjects::publish_subject<int>{};
+    auto trivial       = rpp::subjects::publish_subject<pair>{};
+    auto non_trivial   = rpp::subjects::publish_subject<std::string>{};
+    bool inconsistent  = false;
+    bool got_combined  = false;
+    constexpr size_t count = 10'000;
+
+    source.get_observable()
+        | rpp::ops::with_latest_from(trivial.get_observable(), non_trivial.get_observable())
+        | rpp::ops::subscribe([&](const std::tuple<int, pair, std::string>& v) {
+              got_combined = true;
+              const auto& [_, p, s] = v;
+              inconsistent |= p.first != p.second;
+              inconsistent |= s.find_first_not_of(s.front()) != std::string::npos;
+          });
+
+    trivial.get_observer().on_next(pair{});
+    non_trivial.get_observer().on_next(std::string(64, 'a'));
+
+    std::thread th{[trivial_obs = trivial.get_observer(), non_trivial_obs = non_trivial.get_observer()] {
+        for (size_t i = 0; i < count; ++i)
+        {
+            trivial_obs.on_next(pair{i, i});
+            non_trivial_obs.on_next(std::string(64, static_cast<char>('a' + i % 26)));
+        }
+    }};
+
+    const auto observer = source.get_observer();
+    for (size_t i = 0; i < count; ++i)
+        observer.on_next(static_cast<int>(i));
+
+    th.join();
+
+    CHECK(got_combined);
+    CHECK(!inconsistent);
+}
+
+TEST_CASE("snapshot of latest value is released while some reader is always active")
+{
+    rpp::utils::snapshot_value<std::shared_ptr<int>> value{};
+    value.store(std::make_shared<int>());
+
+    // each reader holds snapshot till it is released, next reader starts before previous one is released
+    std::atomic<size_t> entered{};
+    std::atomic<size_t> released{};
+    const auto          start_reader = [&](size_t index) {
+        std::thread reader{[&, index] {
+            const auto snapshot = value.load();
+            entered.store(index);
+            while (released.load() < index)
+                std::this_thread::yield();
+        }};
+        while (entered.load() < index)
+            std::this_thread::yield();
+        return reader;
+    };
+
+    std::vector<std::weak_ptr<int>> stored{};
+    std::thread                     previous = start_reader(1);
+    for (size_t i = 2; i < 100; ++i)
+    {
+        std::thread current = start_reader(i);
+        released.store(i - 1);
+        previous.join();
+        previous = std::move(current);
+
+        auto v = std::make_shared<int>(static_cast<int>(i));
+        stored.push_back(v);
+        value.store(std::move(v));
+
+        if (stored.size() > 3)
+            CHECK(stored[stored.size() - 4].expired());
+    }
+
+    released.store(std::numeric_limits<size_t>::max());
+    previous.join();
+
+    CHECK(**value.load() == 99);
+    for (size_t i = 0; i + 1 < stored.size(); ++i)
+        CHECK(stored[i].expired());
+}
+
 TEST_CASE("with_latest_from handles current_thread scheduling")
 {
     auto mock = mock_observer_strategy<std::tuple<int, int>>{};
@@ -24,6 +24,8 @@
 #include "copy_count_tracker.hpp"
 #include "disposable_observable.hpp"
 
+#include <thread>
+
 TEST_CASE("zip zips items")
 {
     SUBCASE("observable of -1-2-3-| zip with -4-5-6-| on immediate scheduler")
@@ -190,6 +192,118 @@ TEST_CASE("zip is not deadlocking is_disposed")
           });
 }
 
+TEST_CASE("zip with options limits pending values")
+{
+    auto mock    = mock_observer_strategy<std::tuple<int, int>>{};
+    auto first   = rpp::subjects::publish_subject<int>{};
+    auto second  = rpp::subjects::publish_subject<int>{};
+    auto metrics = std::make_shared<rpp::ops::zip_metrics>(2);
+
+    auto subscribe_with = [&](rpp::ops::backpressure_overflow overflow) {
+        first.get_observable()
+            | rpp::ops::zip(rpp::ops::zip_options{.capacity = 2, .overflow = overflow, .metrics = metrics}, second.get_observable())
+            | rpp::ops::subscribe(mock);
+    };
+
+    SUBCASE("DropNewest drops values arrived after capacity reached")
+    {
+        subscribe_with(rpp::ops::backpressure_overflow::DropNewest);
+        for (int v : {1, 2, 3})
+            first.get_observer().on_next(v);
+
+        CHECK(metrics->pending(0) == 2);
+        CHECK(metrics->pending(1) == 0);
+        CHECK(metrics->dropped() == 1);
+
+        second.get_observer().on_next(10);
+        second.get_observer().on_next(20);
+        second.get_observer().on_next(30);
+        CHECK(mock.get_received_values() == std::vector<std::tuple<int, int>>{{1, 10}, {2, 20}});
+        CHECK(metrics->pending(0) == 0);
+        CHECK(metrics->pending(1) == 1);
+        CHECK(mock.get_on_error_count() == 0);
+    }
+
+    SUBCASE("DropOldest replaces the oldest pending value")
+    {
+        subscribe_with(rpp::ops::backpressure_overflow::DropOldest);
+        for (int v : {1, 2, 3})
+            first.get_observer().on_next(v);
+
+        CHECK(metrics->pending(0) == 2);
+        CHECK(metrics->dropped() == 1);
+
+        second.get_observer().on_next(10);
+        second.get_observer().on_next(20);
+        CHECK(mock.get_received_values() == std::vector<std::tuple<int, int>>{{2, 10}, {3, 20}});
+        CHECK(mock.get_on_error_count() == 0);
+    }
+
+    SUBCASE("Error emits buffer_overflow and disposes sources")
+    {
+        subscribe_with(rpp::ops::backpressure_overflow::Error);
+        for (int v : {1, 2, 3})
+            first.get_observer().on_next(v);
+
+        CHECK(mock.get_on_error_count() == 1);
+        CHECK(mock.get_received_values().empty());
+        CHECK(metrics->dropped() == 0);
+        CHECK(metrics->pending(0) == 0);
+        CHECK(metrics->pending(1) == 0);
+
+        second.get_observer().on_next(10);
+        CHECK(mock.get_received_values().empty());
+    }
+}
+
+TEST_CASE("zip with Block overflow blocks producer till its value zipped")
+{
+    auto mock   = mock_observer_strategy<std::tuple<int, int>>{};
+    auto first  = rpp::subjects::publish_subject<int>{};
+    auto second = rpp::subjects::publish_subject<int>{};
+
+    first.get_observable()
+        | rpp::ops::zip(rpp::ops::zip_options{.capacity = 1, .overflow = rpp::ops::backpressure_overflow::Block}, second.get_observable())
+        | rpp::ops::subscribe(mock);
+
+    std::atomic_bool second_value_sent{};
+    std::thread      producer{[&, observer = first.get_observer()] {
+        observer.on_next(1);
+        observer.on_next(2);
+        second_value_sent = true;
+    }};
+
+    std::this_thread::sleep_for(std::chrono::milliseconds{100});
+    CHECK(!second_value_sent);
+
+    second.get_observer().on_next(10);
+    producer.join();
+    CHECK(second_value_sent);
+
+    second.get_observer().on_next(20);
+    CHECK(mock.get_received_values() == std::vector<std::tuple<int, int>>{{1, 10}, {2, 20}});
+}
+
+TEST_CASE("zip with Block overflow releases blocked producer on dispose")
+{
+    auto first  = rpp::subjects::publish_subject<int>{};
+    auto second = rpp::subjects::publish_subject<int>{};
+    auto d      = rpp::composite_disposable_wrapper::make();
+
+    first.get_observable()
+        | rpp::ops::zip(rpp::ops::zip_options{.capacity = 1, .overflow = rpp::ops::backpressure_overflow::Block}, second.get_observable())
+        | rpp::ops::subscribe(d, [](const auto&) {});
+
+    std::thread producer{[observer = first.get_observer()] {
+        observer.on_next(1);
+        observer.on_next(2);
+    }};
+
+    std::this_thread::sleep_for(std::chrono::milliseconds{100});
+    d.dispose();
+    producer.join();
+}
+
 TEST_CASE("zip satisfies disposable contracts")
 {
     auto observable_disposable = rpp::composite_disposable_wrapper::make();
@@ -203,3 +317,10 @@ TEST_CASE("zip satisfies disposable contracts")
 
     CHECK((observable_disposable.is_disposed() || observable_disposable.lock().use_count() == 2));
 }
+
+TEST_CASE("zip with options satisfies disposable contracts")
+{
+    auto op = rpp::ops::zip(rpp::ops::zip_options{.capacity = 4, .overflow = rpp::ops::backpressure_overflow::DropOldest}, rpp::source::never<int>());
+
+    test_operator_with_disposable<int>(op);
+}